@@ -0,0 +1,84 @@
+#ifndef AABB_H
+#define AABB_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/// <summary>
+/// A plain axis-aligned bounding box. Cheap to copy, so collision code passes these around instead of whole components.
+/// </summary>
+struct AABB
+{
+	/// <summary>
+	/// The x-axis coordinate of the left side.
+	/// </summary>
+	float left;
+
+	/// <summary>
+	/// The y-axis coordinate of the top side.
+	/// </summary>
+	float top;
+
+	/// <summary>
+	/// The x-axis coordinate of the right side.
+	/// </summary>
+	float right;
+
+	/// <summary>
+	/// The y-axis coordinate of the bottom side.
+	/// </summary>
+	float bottom;
+
+	/// <summary>
+	/// Creates the bounding box of a rectangle with the provided center and dimensions.
+	/// </summary>
+	/// <param name="center">The center of the rectangle.</param>
+	/// <param name="dimensions">The width and height of the rectangle.</param>
+	/// <returns>The bounding box of the rectangle.</returns>
+	static AABB fromCenter(sf::Vector2f center, sf::Vector2f dimensions)
+	{
+		AABB box;
+		box.left = center.x - (dimensions.x / 2);
+		box.top = center.y - (dimensions.y / 2);
+		box.right = center.x + (dimensions.x / 2);
+		box.bottom = center.y + (dimensions.y / 2);
+		return box;
+	}
+
+	/// <summary>
+	/// Returns true if this box overlaps or touches the provided box.
+	/// </summary>
+	/// <param name="other">The other box.</param>
+	/// <returns>True if the two boxes overlap or touch.</returns>
+	bool overlaps(const AABB& other) const
+	{
+		return right >= other.left && left <= other.right && bottom >= other.top && top <= other.bottom;
+	}
+
+	/// <summary>
+	/// Tests every box in the provided array against the provided box. Bit i % 64 of mask[i / 64] is set when box i overlaps.
+	/// </summary>
+	/// <param name="boxes">A pointer to the first box to test.</param>
+	/// <param name="count">The number of boxes to test.</param>
+	/// <param name="other">The box every box is tested against.</param>
+	/// <param name="mask">Resized to hold one bit per box and filled with the results.</param>
+	static void overlaps(const AABB* boxes, std::size_t count, const AABB& other, std::vector<sf::Uint64>& mask)
+	{
+		mask.assign((count + 63) / 64, 0);
+		for (std::size_t word = 0; word < mask.size(); word++)
+		{
+			std::size_t first = word * 64;
+			std::size_t last = first + 64 < count ? first + 64 : count;
+			sf::Uint64 bits = 0;
+			for (std::size_t i = first; i < last; i++)
+			{
+				const AABB& box = boxes[i];
+				sf::Uint64 hit = (box.right >= other.left) & (box.left <= other.right) & (box.bottom >= other.top) & (box.top <= other.bottom);
+				bits |= hit << (i - first);
+			}
+			mask[word] = bits;
+		}
+	}
+};
+
+#endif // !AABB_H
@@ -0,0 +1,164 @@
+#include "AssetLoader.h"
+
+AssetLoader::AssetLoader()
+{
+	nextToDecode = 0;
+	finalizedCount = 0;
+	isStarted = false;
+}
+
+AssetLoader::~AssetLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		nextToDecode = assets.size();
+	}
+
+	for (std::size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+	}
+}
+
+void AssetLoader::requestSoundBuffer(const std::string& path)
+{
+	if (isStarted || ResourceCache::getInstance().hasSoundBuffer(path)) return;
+
+	PendingAsset asset;
+	asset.type = AssetType::SoundBuffer;
+	asset.path = path;
+	asset.didDecode = false;
+	asset.channelCount = 0;
+	asset.sampleRate = 0;
+	assets.push_back(asset);
+}
+
+void AssetLoader::requestTextureAtlas(const std::string& specPath, const std::string& atlasName)
+{
+	if (isStarted || ResourceCache::getInstance().hasTextureAtlas(specPath, atlasName)) return;
+
+	PendingAsset asset;
+	asset.type = AssetType::TextureAtlas;
+	asset.path = specPath;
+	asset.name = atlasName;
+	asset.didDecode = false;
+	asset.channelCount = 0;
+	asset.sampleRate = 0;
+	assets.push_back(asset);
+}
+
+void AssetLoader::start(unsigned int threadCount)
+{
+	if (isStarted) return;
+
+	isStarted = true;
+	if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	threadCount = (unsigned int)std::min<std::size_t>(threadCount, assets.size());
+
+	for (unsigned int i = 0; i < threadCount; i++)
+	{
+		workers.push_back(std::thread(&AssetLoader::decodeAssets, this));
+	}
+}
+
+unsigned int AssetLoader::finalize(unsigned int maxAssets)
+{
+	unsigned int finalized = 0;
+	while (finalized < maxAssets)
+	{
+		std::size_t index;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (decoded.empty()) break;
+
+			index = decoded.front();
+			decoded.pop_front();
+		}
+
+		upload(assets[index]);
+		finalizedCount++;
+		finalized++;
+	}
+
+	return finalized;
+}
+
+float AssetLoader::getProgress()
+{
+	if (assets.empty()) return 1.0f;
+
+	return (float)finalizedCount / assets.size();
+}
+
+bool AssetLoader::getIsDone()
+{
+	return finalizedCount == assets.size();
+}
+
+void AssetLoader::decodeAssets()
+{
+	while (true)
+	{
+		std::size_t index;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (nextToDecode >= assets.size()) return;
+
+			index = nextToDecode++;
+		}
+
+		assets[index].didDecode = decode(assets[index]);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		decoded.push_back(index);
+	}
+}
+
+bool AssetLoader::decode(PendingAsset& asset)
+{
+	switch (asset.type)
+	{
+	case AssetType::SoundBuffer:
+	{
+		sf::InputSoundFile file;
+		if (!file.openFromFile(asset.path)) return false;
+
+		asset.samples.resize((std::size_t)file.getSampleCount());
+		asset.channelCount = file.getChannelCount();
+		asset.sampleRate = file.getSampleRate();
+		return file.read(asset.samples.data(), asset.samples.size()) == asset.samples.size();
+	}
+	case AssetType::TextureAtlas:
+		return TextureAtlas::decode(asset.path, asset.name, asset.image, asset.rects);
+	default:
+		return false;
+	}
+}
+
+void AssetLoader::upload(PendingAsset& asset)
+{
+	ResourceCache& cache = ResourceCache::getInstance();
+	switch (asset.type)
+	{
+	case AssetType::SoundBuffer:
+	{
+		std::shared_ptr<sf::SoundBuffer> soundBuffer = std::make_shared<sf::SoundBuffer>();
+		bool didLoad = asset.didDecode
+			&& soundBuffer->loadFromSamples(asset.samples.data(), asset.samples.size(), asset.channelCount, asset.sampleRate);
+		cache.addSoundBuffer(asset.path, soundBuffer, didLoad);
+		std::vector<sf::Int16>().swap(asset.samples);
+		break;
+	}
+	case AssetType::TextureAtlas:
+	{
+		std::shared_ptr<TextureAtlas> atlas = std::make_shared<TextureAtlas>();
+		bool didLoad = asset.didDecode && atlas->loadFromImage(asset.image, asset.rects);
+		cache.addTextureAtlas(asset.path, asset.name, atlas, didLoad);
+		asset.image = sf::Image();
+		asset.rects.clear();
+		break;
+	}
+	default:
+		break;
+	}
+}
@@ -0,0 +1,182 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include "AssetType.h"
+#include "ResourceCache.h"
+#include "TextureAtlas.h"
+
+/// <summary>
+/// An asset requested from the asset loader, along with the data decoded for it by a worker thread.
+/// </summary>
+struct PendingAsset
+{
+	/// <summary>
+	/// The kind of asset.
+	/// </summary>
+	AssetType type;
+
+	/// <summary>
+	/// The path of the sound file, or of the spec file listing the atlas.
+	/// </summary>
+	std::string path;
+
+	/// <summary>
+	/// The name of the atlas. Empty for sound buffers.
+	/// </summary>
+	std::string name;
+
+	/// <summary>
+	/// Is true if the worker thread decoded the asset.
+	/// </summary>
+	bool didDecode;
+
+	/// <summary>
+	/// The decoded atlas image.
+	/// </summary>
+	sf::Image image;
+
+	/// <summary>
+	/// The rectangle of each image in the decoded atlas image, by name.
+	/// </summary>
+	std::map<std::string, sf::IntRect> rects;
+
+	/// <summary>
+	/// The decoded audio samples.
+	/// </summary>
+	std::vector<sf::Int16> samples;
+
+	/// <summary>
+	/// The number of audio channels of the decoded samples.
+	/// </summary>
+	unsigned int channelCount;
+
+	/// <summary>
+	/// The sample rate of the decoded samples.
+	/// </summary>
+	unsigned int sampleRate;
+};
+
+/// <summary>
+/// Streams assets into the resource cache without stalling the thread that draws the window. Worker threads read and decode the files
+/// into images and audio samples held in memory. The thread that owns the window then creates the textures and sound buffers from the
+/// decoded data a few assets at a time by calling finalize once per update, and reports progress while it does.
+/// </summary>
+class AssetLoader
+{
+public:
+	/// <summary>
+	/// Initializes a loader with no requested assets.
+	/// </summary>
+	AssetLoader();
+
+	/// <summary>
+	/// Waits for the worker threads to finish. Assets decoded but not finalized are discarded.
+	/// </summary>
+	~AssetLoader();
+
+	/// <summary>
+	/// Requests the sound buffer loaded from the provided path. Ignored if the buffer is already cached or the loader has started.
+	/// </summary>
+	/// <param name="path">The path of the sound file.</param>
+	void requestSoundBuffer(const std::string& path);
+
+	/// <summary>
+	/// Requests the texture atlas with the provided name from the provided spec file. Ignored if the atlas is already cached or the loader
+	/// has started.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas.</param>
+	void requestTextureAtlas(const std::string& specPath, const std::string& atlasName);
+
+	/// <summary>
+	/// Starts decoding the requested assets on worker threads.
+	/// </summary>
+	/// <param name="threadCount">The number of worker threads, or 0 to use one per processor. Never more than one per asset.</param>
+	void start(unsigned int threadCount = 0);
+
+	/// <summary>
+	/// Creates the textures and sound buffers of assets that have finished decoding and adds them to the resource cache. Must be called
+	/// from the thread that draws the window.
+	/// </summary>
+	/// <param name="maxAssets">The most assets to finalize in this call, which bounds how long the call can take.</param>
+	/// <returns>The number of assets finalized.</returns>
+	unsigned int finalize(unsigned int maxAssets);
+
+	/// <summary>
+	/// Gets the portion of the requested assets that have been finalized.
+	/// </summary>
+	/// <returns>A value from 0 to 1. 1 if no assets were requested.</returns>
+	float getProgress();
+
+	/// <summary>
+	/// Returns true when every requested asset has been finalized.
+	/// </summary>
+	/// <returns>True when every requested asset has been finalized.</returns>
+	bool getIsDone();
+
+private:
+	/// <summary>
+	/// The requested assets. Not resized once the loader has started, since the worker threads hold references into it.
+	/// </summary>
+	std::vector<PendingAsset> assets;
+
+	/// <summary>
+	/// The index of the next asset a worker thread will decode.
+	/// </summary>
+	std::size_t nextToDecode;
+
+	/// <summary>
+	/// The indices of the assets that have been decoded but not finalized, in the order they finished.
+	/// </summary>
+	std::deque<std::size_t> decoded;
+
+	/// <summary>
+	/// The number of assets that have been finalized.
+	/// </summary>
+	std::size_t finalizedCount;
+
+	/// <summary>
+	/// Is true once start has been called.
+	/// </summary>
+	bool isStarted;
+
+	/// <summary>
+	/// The worker threads decoding the assets.
+	/// </summary>
+	std::vector<std::thread> workers;
+
+	/// <summary>
+	/// Guards nextToDecode and decoded, which are shared with the worker threads.
+	/// </summary>
+	std::mutex mutex;
+
+	/// <summary>
+	/// Decodes assets until none are left. Run by each worker thread.
+	/// </summary>
+	void decodeAssets();
+
+	/// <summary>
+	/// Reads and decodes the file of the provided asset.
+	/// </summary>
+	/// <param name="asset">The asset to decode.</param>
+	/// <returns>True if the asset was decoded.</returns>
+	static bool decode(PendingAsset& asset);
+
+	/// <summary>
+	/// Creates the texture or sound buffer of the provided decoded asset, adds it to the resource cache and frees the decoded data.
+	/// </summary>
+	/// <param name="asset">The asset to finalize.</param>
+	static void upload(PendingAsset& asset);
+};
+
+#endif // !ASSET_LOADER_H
@@ -0,0 +1,13 @@
+#ifndef ASSET_TYPE_H
+#define ASSET_TYPE_H
+
+/// <summary>
+/// Enum representing the kinds of asset the asset loader can stream.
+/// </summary>
+enum class AssetType
+{
+	SoundBuffer,
+	TextureAtlas
+};
+
+#endif // !ASSET_TYPE_H
@@ -0,0 +1,40 @@
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "TextureAtlas.h"
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cout << "Usage: PA8AtlasPacker <atlas spec file>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string specPath = argv[1];
+    std::map<std::string, std::vector<std::string>> atlases;
+    if (!TextureAtlas::readSpec(specPath, atlases)) return EXIT_FAILURE;
+
+    std::string directory = TextureAtlas::getDirectory(specPath);
+    for (std::map<std::string, std::vector<std::string>>::const_iterator i = atlases.begin(); i != atlases.end(); i++)
+    {
+        sf::Image atlasImage;
+        std::map<std::string, sf::IntRect> packedRects;
+        if (!TextureAtlas::packImages(i->second, atlasImage, packedRects)) return EXIT_FAILURE;
+
+        std::string textureFileName = i->first + "_atlas.png";
+        if (!atlasImage.saveToFile(directory + textureFileName))
+        {
+            std::cout << "Failed to save " << textureFileName << "." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (!TextureAtlas::writeManifest(directory + i->first + ".atlas", textureFileName, packedRects)) return EXIT_FAILURE;
+
+        std::cout << "Packed " << packedRects.size() << " images into " << textureFileName << " ("
+            << atlasImage.getSize().x << "x" << atlasImage.getSize().y << ")" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,8 @@
+#include <iostream>
+#include "SwarmBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+    SwarmBenchmark benchmark(argc, argv);
+    return benchmark.run();
+}
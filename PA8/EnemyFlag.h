@@ -0,0 +1,16 @@
+#ifndef ENEMY_FLAG_H
+#define ENEMY_FLAG_H
+
+/// <summary>
+/// Enum representing the boolean state flags of a ghost enemy. Each value is a single bit so they can be packed into one byte per enemy.
+/// </summary>
+enum class EnemyFlag : unsigned char
+{
+	None = 0,
+	IsDying = 1,
+	IsDead = 2,
+	IsAttacking = 4,
+	DidAttack = 8,
+	IsMirrored = 16
+};
+#endif // !ENEMY_FLAG_H
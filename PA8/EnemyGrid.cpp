@@ -0,0 +1,78 @@
+#include "EnemyGrid.h"
+
+EnemyGrid::EnemyGrid()
+{
+	cellSize = 1.0f;
+	columns = 1;
+	rows = 1;
+	cellStart.assign(2, 0);
+}
+
+EnemyGrid::~EnemyGrid()
+{
+}
+
+void EnemyGrid::configure(sf::VideoMode vm, float newCellSize)
+{
+	cellSize = newCellSize;
+	columns = std::max((int)std::ceil(vm.width / cellSize), 1);
+	rows = std::max((int)std::ceil(vm.height / cellSize), 1);
+	cellStart.assign(columns * rows + 1, 0);
+	cursor.assign(columns * rows, 0);
+	entries.clear();
+}
+
+void EnemyGrid::rebuild(const EnemyStore& enemies)
+{
+	std::fill(cellStart.begin(), cellStart.end(), 0);
+
+	for (std::size_t i = 0; i < enemies.size(); i++)
+	{
+		AABB bounds = enemies.getBounds(i);
+		int lastColumn = columnOf(bounds.right);
+		int lastRow = rowOf(bounds.bottom);
+		for (int row = rowOf(bounds.top); row <= lastRow; row++)
+		{
+			for (int column = columnOf(bounds.left); column <= lastColumn; column++)
+			{
+				cellStart[row * columns + column + 1]++;
+			}
+		}
+	}
+
+	for (std::size_t cell = 1; cell < cellStart.size(); cell++)
+	{
+		cellStart[cell] += cellStart[cell - 1];
+	}
+
+	entries.resize(cellStart.back());
+	std::copy(cellStart.begin(), cellStart.end() - 1, cursor.begin());
+
+	for (std::size_t i = 0; i < enemies.size(); i++)
+	{
+		AABB bounds = enemies.getBounds(i);
+		int lastColumn = columnOf(bounds.right);
+		int lastRow = rowOf(bounds.bottom);
+		for (int row = rowOf(bounds.top); row <= lastRow; row++)
+		{
+			for (int column = columnOf(bounds.left); column <= lastColumn; column++)
+			{
+				entries[cursor[row * columns + column]++] = (sf::Uint32)i;
+			}
+		}
+	}
+}
+
+void EnemyGrid::query(const AABB& bounds, std::vector<sf::Uint32>& candidates) const
+{
+	int lastColumn = columnOf(bounds.right);
+	int lastRow = rowOf(bounds.bottom);
+	for (int row = rowOf(bounds.top); row <= lastRow; row++)
+	{
+		for (int column = columnOf(bounds.left); column <= lastColumn; column++)
+		{
+			int cell = row * columns + column;
+			candidates.insert(candidates.end(), entries.begin() + cellStart[cell], entries.begin() + cellStart[cell + 1]);
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#ifndef ENEMY_GRID_H
+#define ENEMY_GRID_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "EnemyStore.h"
+
+/// <summary>
+/// A uniform grid over the screen used as the broad phase for collisions against enemies. Each cell lists the indices of the enemies
+/// overlapping it, so a query only needs to test the enemies in the cells the other rectangle overlaps. Enemies outside the screen are
+/// clamped into the border cells.
+/// </summary>
+class EnemyGrid
+{
+public:
+	/// <summary>
+	/// Initializes an empty grid with a single cell.
+	/// </summary>
+	EnemyGrid();
+
+	~EnemyGrid();
+
+	/// <summary>
+	/// Divides the provided screen into square cells of the provided size. Must be called before the first rebuild.
+	/// </summary>
+	/// <param name="vm">The video mode of the screen covered by this grid.</param>
+	/// <param name="newCellSize">The width and height of each cell in pixels.</param>
+	void configure(sf::VideoMode vm, float newCellSize);
+
+	/// <summary>
+	/// Clears the grid and inserts every enemy of the provided store at its current position.
+	/// </summary>
+	/// <param name="enemies">The store holding the enemies to insert.</param>
+	void rebuild(const EnemyStore& enemies);
+
+	/// <summary>
+	/// Collects the indices of every enemy sharing a cell with the provided bounding box. An enemy overlapping several of those cells is
+	/// collected once per cell, and collected enemies still need a narrow phase test.
+	/// </summary>
+	/// <param name="bounds">The bounding box to query.</param>
+	/// <param name="candidates">The vector the enemy indices are appended to.</param>
+	void query(const AABB& bounds, std::vector<sf::Uint32>& candidates) const;
+
+private:
+	/// <summary>
+	/// The width and height of each cell in pixels.
+	/// </summary>
+	float cellSize;
+
+	/// <summary>
+	/// The number of columns of cells.
+	/// </summary>
+	int columns;
+
+	/// <summary>
+	/// The number of rows of cells.
+	/// </summary>
+	int rows;
+
+	/// <summary>
+	/// The offset into entries of the first enemy of each cell. Has one extra element so the entries of cell i are
+	/// entries[cellStart[i]] up to entries[cellStart[i + 1]].
+	/// </summary>
+	std::vector<sf::Uint32> cellStart;
+
+	/// <summary>
+	/// The enemy indices of every cell stored back to back.
+	/// </summary>
+	std::vector<sf::Uint32> entries;
+
+	/// <summary>
+	/// The next free position in entries of each cell, used while rebuilding.
+	/// </summary>
+	std::vector<sf::Uint32> cursor;
+
+	/// <summary>
+	/// Gets the column containing the provided x-axis coordinate, clamped to the grid.
+	/// </summary>
+	/// <param name="x">The x-axis coordinate.</param>
+	/// <returns>The column containing the coordinate.</returns>
+	int columnOf(float x) const
+	{
+		return std::min(std::max((int)(x / cellSize), 0), columns - 1);
+	}
+
+	/// <summary>
+	/// Gets the row containing the provided y-axis coordinate, clamped to the grid.
+	/// </summary>
+	/// <param name="y">The y-axis coordinate.</param>
+	/// <returns>The row containing the coordinate.</returns>
+	int rowOf(float y) const
+	{
+		return std::min(std::max((int)(y / cellSize), 0), rows - 1);
+	}
+};
+
+#endif // !ENEMY_GRID_H
@@ -0,0 +1,397 @@
+#include "EnemyStore.h"
+
+const static sf::Uint32 notTargetable = 0xFFFFFFFF;
+const static std::size_t enemiesAdvancedPerRange = 4096;
+const static std::size_t enemiesAnimatedPerRange = 4096;
+// How long each frame of each track is shown, indexed by GhostAnimationTrack.
+const static sf::Int64 trackFramePeriods[] = { 500000, 200000, 200000 };
+const static GhostFrameStep keepSize = { GhostAnimation::TailUp, 0, false, 1.0f, 1.0f, 0.0f, 0.0f };
+// The step taken from each frame of each track when its frame period runs out, indexed by GhostAnimationTrack and then GhostAnimation.
+// Every frame has an entry on every track, since a ghost can switch tracks in the middle of a sequence.
+const static GhostFrameStep ghostFrameSteps[3][14] = {
+	// Idle: flick the tail up and down.
+	{
+		{ GhostAnimation::TailDown, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::TailUp, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		keepSize, keepSize, keepSize, keepSize, keepSize,
+		keepSize, keepSize, keepSize, keepSize, keepSize, keepSize, keepSize
+	},
+	// Attacking: grow into the attack frames, then shrink to the first death frame once the attack lands.
+	{
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack1, 0, true, 0.95f, 1.48f, 0.0f, 0.48f },
+		{ GhostAnimation::Attack2, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Attack3, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Attack4, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Attack5, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Attack6, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Attack7, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, (unsigned char)EnemyFlag::DidAttack, true, 1.0526f, 0.6756f, 0.0f, -0.3244f }
+	},
+	// Dying: resize out of the tail frames into the death frames, then hold the last one once the ghost is dead.
+	{
+		{ GhostAnimation::Death1, 0, true, 0.85f, 1.2f, -0.15f, 0.2f },
+		{ GhostAnimation::Death1, 0, true, 0.85f, 1.2f, -0.15f, 0.2f },
+		{ GhostAnimation::Death2, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death3, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death4, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death5, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death5, (unsigned char)EnemyFlag::IsDead, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f },
+		{ GhostAnimation::Death1, 0, false, 1.0f, 1.0f, 0.0f, 0.0f }
+	}
+};
+
+EnemyStore::EnemyStore()
+{
+	distanceAdvanced = 0.0;
+}
+
+EnemyStore::~EnemyStore()
+{
+}
+
+EnemyHandle EnemyStore::spawn(sf::VideoMode vm, RandomStream& random)
+{
+	sf::Vector2f baseDimensions = getBaseDimensions(vm);
+	float newWidth = baseDimensions.x;
+	float newHeight = baseDimensions.y;
+
+	float randomPercent = random.nextFloat();
+	bool isDown = random.nextBool();
+	bool isRight = random.nextBool();
+	bool isVerticalShift = random.nextBool();
+
+	float newX = isRight ? vm.width + (newWidth / 2.0f) : 0 - (newWidth / 2.0f);
+	float newY = isDown ? vm.height + (newHeight / 2.0f) : 0 - (newHeight / 2.0f);
+
+	if (isVerticalShift)
+	{
+		newY += isDown ? -randomPercent * vm.height : randomPercent * vm.height;
+	}
+	else {
+		newX += isRight ? -randomPercent * vm.width : randomPercent * vm.width;
+	}
+
+	unsigned char newFlags = (unsigned char)EnemyFlag::None;
+	if (newX < (float)vm.width / 2.0f)
+	{
+		newFlags |= (unsigned char)EnemyFlag::IsMirrored;
+	}
+
+	EnemyHandle newHandle;
+	if (freeSlots.empty())
+	{
+		newHandle.slot = (sf::Uint32)slotIndex.size();
+		slotIndex.push_back(0);
+		slotGeneration.push_back(0);
+		slotTargetablePosition.push_back(notTargetable);
+		slotArrivalDistance.push_back(0.0);
+	}
+	else {
+		newHandle.slot = freeSlots.back();
+		freeSlots.pop_back();
+	}
+
+	newHandle.generation = slotGeneration[newHandle.slot];
+	slotIndex[newHandle.slot] = (sf::Uint32)handles.size();
+	handles.push_back(newHandle);
+	positionX.push_back(newX);
+	positionY.push_back(newY);
+	previousPositionX.push_back(newX);
+	previousPositionY.push_back(newY);
+	width.push_back(newWidth);
+	height.push_back(newHeight);
+	originX.push_back(newWidth / 2.0f);
+	originY.push_back(newHeight / 2.0f);
+	animation.push_back(GhostAnimation::TailUp);
+	microSecondsElapsed.push_back(0);
+	flags.push_back(newFlags);
+
+	slotArrivalDistance[newHandle.slot] = distanceAdvanced + std::hypot(newX - (float)vm.width / 2.0f, newY - (float)vm.height / 2.0f);
+	slotTargetablePosition[newHandle.slot] = (sf::Uint32)targetableSlots.size();
+	targetableSlots.push_back(newHandle.slot);
+	arrivalOrder.insert(std::make_pair(slotArrivalDistance[newHandle.slot], newHandle.slot));
+	return newHandle;
+}
+
+bool EnemyStore::destroy(EnemyHandle handle)
+{
+	std::size_t index;
+	if (!findIndex(handle, index)) return false;
+
+	removeTarget(handle.slot);
+	std::size_t last = handles.size() - 1;
+	if (index != last)
+	{
+		handles[index] = handles[last];
+		slotIndex[handles[index].slot] = (sf::Uint32)index;
+		positionX[index] = positionX[last];
+		positionY[index] = positionY[last];
+		previousPositionX[index] = previousPositionX[last];
+		previousPositionY[index] = previousPositionY[last];
+		width[index] = width[last];
+		height[index] = height[last];
+		originX[index] = originX[last];
+		originY[index] = originY[last];
+		animation[index] = animation[last];
+		microSecondsElapsed[index] = microSecondsElapsed[last];
+		flags[index] = flags[last];
+	}
+
+	handles.pop_back();
+	positionX.pop_back();
+	positionY.pop_back();
+	previousPositionX.pop_back();
+	previousPositionY.pop_back();
+	width.pop_back();
+	height.pop_back();
+	originX.pop_back();
+	originY.pop_back();
+	animation.pop_back();
+	microSecondsElapsed.pop_back();
+	flags.pop_back();
+
+	slotGeneration[handle.slot]++;
+	freeSlots.push_back(handle.slot);
+	return true;
+}
+
+bool EnemyStore::contains(EnemyHandle handle) const
+{
+	std::size_t index;
+	return findIndex(handle, index);
+}
+
+std::size_t EnemyStore::size() const
+{
+	return handles.size();
+}
+
+bool EnemyStore::empty() const
+{
+	return handles.empty();
+}
+
+EnemyHandle EnemyStore::getHandle(std::size_t index) const
+{
+	return handles[index];
+}
+
+sf::Vector2f EnemyStore::getCenterCoordinates(std::size_t index) const
+{
+	return sf::Vector2f(positionX[index], positionY[index]);
+}
+
+std::size_t EnemyStore::getTargetableCount() const
+{
+	return targetableSlots.size();
+}
+
+std::size_t EnemyStore::getTargetableIndex(std::size_t targetable) const
+{
+	return slotIndex[targetableSlots[targetable]];
+}
+
+bool EnemyStore::findClosestTarget(std::size_t& index) const
+{
+	if (arrivalOrder.empty()) return false;
+
+	index = slotIndex[arrivalOrder.begin()->second];
+	return true;
+}
+
+std::size_t EnemyStore::findClosestTargets(std::size_t count, std::vector<std::size_t>& indices) const
+{
+	std::size_t found = 0;
+	for (std::set<std::pair<double, sf::Uint32>>::const_iterator i = arrivalOrder.begin(); i != arrivalOrder.end() && found < count; ++i)
+	{
+		indices.push_back(slotIndex[i->second]);
+		found++;
+	}
+
+	return found;
+}
+
+sf::Vector2f EnemyStore::getBaseDimensions(sf::VideoMode vm)
+{
+	return sf::Vector2f(0.042f * vm.width, 0.026f * vm.width);
+}
+
+AABB EnemyStore::getBounds(std::size_t index) const
+{
+	return AABB::fromCenter(sf::Vector2f(positionX[index], positionY[index]), sf::Vector2f(width[index], height[index]));
+}
+
+void EnemyStore::gatherBounds(const sf::Uint32* indices, std::size_t count, std::vector<AABB>& bounds) const
+{
+	bounds.resize(count);
+	for (std::size_t i = 0; i < count; i++)
+	{
+		bounds[i] = getBounds(indices[i]);
+	}
+}
+
+bool EnemyStore::hasFlag(std::size_t index, EnemyFlag flag) const
+{
+	return (flags[index] & (unsigned char)flag) != 0;
+}
+
+void EnemyStore::die(std::size_t index)
+{
+	setFlag(index, EnemyFlag::IsDying);
+	removeTarget(handles[index].slot);
+}
+
+void EnemyStore::attack(std::size_t index)
+{
+	setFlag(index, EnemyFlag::IsAttacking);
+}
+
+void EnemyStore::advanceAnimations(sf::Int64 timeElapsed)
+{
+	advanceAnimationRange(0, handles.size(), timeElapsed);
+}
+
+void EnemyStore::advanceAnimations(sf::Int64 timeElapsed, WorkerPool& workers)
+{
+	workers.parallelFor(handles.size(), enemiesAnimatedPerRange, [this, timeElapsed](std::size_t begin, std::size_t end, unsigned int)
+	{
+		advanceAnimationRange(begin, end, timeElapsed);
+	});
+}
+
+void EnemyStore::advanceTowards(float x, float y, float distanceToShift)
+{
+	if (handles.empty()) return;
+
+	distanceAdvanced += distanceToShift;
+	advanceRangeTowards(0, handles.size(), x, y, distanceToShift);
+}
+
+void EnemyStore::advanceTowards(float x, float y, float distanceToShift, WorkerPool& workers)
+{
+	if (handles.empty()) return;
+
+	distanceAdvanced += distanceToShift;
+	workers.parallelFor(handles.size(), enemiesAdvancedPerRange, [this, x, y, distanceToShift](std::size_t begin, std::size_t end, unsigned int)
+	{
+		advanceRangeTowards(begin, end, x, y, distanceToShift);
+	});
+}
+
+void EnemyStore::advanceRangeTowards(std::size_t begin, std::size_t end, float x, float y, float distanceToShift)
+{
+	MovementKernel::advanceTowards(
+		positionX.data() + begin,
+		positionY.data() + begin,
+		flags.data() + begin,
+		(unsigned char)EnemyFlag::IsDying | (unsigned char)EnemyFlag::IsAttacking,
+		end - begin,
+		x,
+		y,
+		distanceToShift
+		);
+}
+
+void EnemyStore::storePreviousPositions()
+{
+	std::copy(positionX.begin(), positionX.end(), previousPositionX.begin());
+	std::copy(positionY.begin(), positionY.end(), previousPositionY.begin());
+}
+
+void EnemyStore::writeSnapshots(std::vector<GhostSnapshot>& ghosts) const
+{
+	ghosts.resize(handles.size());
+	for (std::size_t i = 0; i < handles.size(); i++)
+	{
+		GhostSnapshot& ghost = ghosts[i];
+		ghost.previousPosition = sf::Vector2f(previousPositionX[i], previousPositionY[i]);
+		ghost.position = sf::Vector2f(positionX[i], positionY[i]);
+		ghost.size = sf::Vector2f(width[i], height[i]);
+		ghost.origin = sf::Vector2f(originX[i], originY[i]);
+		ghost.animation = animation[i];
+		ghost.isMirrored = hasFlag(i, EnemyFlag::IsMirrored);
+	}
+}
+
+bool EnemyStore::findIndex(EnemyHandle handle, std::size_t& index) const
+{
+	if (handle.slot >= slotGeneration.size()) return false;
+	if (slotGeneration[handle.slot] != handle.generation) return false;
+
+	index = slotIndex[handle.slot];
+	return true;
+}
+
+void EnemyStore::removeTarget(sf::Uint32 slot)
+{
+	sf::Uint32 position = slotTargetablePosition[slot];
+	if (position == notTargetable) return;
+
+	sf::Uint32 lastSlot = targetableSlots.back();
+	targetableSlots[position] = lastSlot;
+	slotTargetablePosition[lastSlot] = position;
+	targetableSlots.pop_back();
+	slotTargetablePosition[slot] = notTargetable;
+	arrivalOrder.erase(std::make_pair(slotArrivalDistance[slot], slot));
+}
+
+void EnemyStore::setFlag(std::size_t index, EnemyFlag flag)
+{
+	flags[index] |= (unsigned char)flag;
+}
+
+void EnemyStore::advanceAnimationRange(std::size_t begin, std::size_t end, sf::Int64 timeElapsed)
+{
+	for (std::size_t i = begin; i < end; i++)
+	{
+		GhostAnimationTrack track = GhostAnimationTrack::Idle;
+		if ((flags[i] & (unsigned char)EnemyFlag::IsDying) != 0)
+		{
+			track = GhostAnimationTrack::Dying;
+		}
+		else if ((flags[i] & (unsigned char)EnemyFlag::IsAttacking) != 0)
+		{
+			track = GhostAnimationTrack::Attacking;
+		}
+
+		sf::Int64 framePeriod = trackFramePeriods[(int)track];
+		microSecondsElapsed[i] += timeElapsed;
+		if (microSecondsElapsed[i] <= framePeriod) continue;
+
+		microSecondsElapsed[i] -= framePeriod;
+		const GhostFrameStep& step = ghostFrameSteps[(int)track][(int)animation[i]];
+		if (step.resizes)
+		{
+			updateDimensions(i, sf::Vector2f(width[i] * step.widthScale, height[i] * step.heightScale), sf::Vector2f(width[i] * step.originOffsetX, height[i] * step.originOffsetY));
+		}
+
+		flags[i] |= step.flagsToSet;
+		animation[i] = step.next;
+	}
+}
+
+void EnemyStore::updateDimensions(std::size_t index, sf::Vector2f dimensions, sf::Vector2f originOffset)
+{
+	float oldWidth = width[index];
+	float oldHeight = height[index];
+	positionX[index] += (oldWidth - dimensions.x) / 2.0f;
+	positionY[index] += (oldHeight - dimensions.y) / 2.0f;
+	previousPositionX[index] += (oldWidth - dimensions.x) / 2.0f;
+	previousPositionY[index] += (oldHeight - dimensions.y) / 2.0f;
+	originX[index] = (oldWidth + originOffset.x) / 2.0f;
+	originY[index] = (oldHeight + originOffset.y) / 2.0f;
+	width[index] = dimensions.x;
+	height[index] = dimensions.y;
+}
@@ -0,0 +1,369 @@
+#ifndef ENEMY_STORE_H
+#define ENEMY_STORE_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <set>
+#include <utility>
+#include "GhostAnimation.h"
+#include "GhostAnimationTrack.h"
+#include "GhostFrameStep.h"
+#include "EnemyFlag.h"
+#include "AABB.h"
+#include "MovementKernel.h"
+#include "RandomStream.h"
+#include "WorkerPool.h"
+#include "RenderSnapshot.h"
+
+/// <summary>
+/// A stable handle referring to a single ghost enemy in an enemy store. The slot stays with the enemy for its whole life, unlike the index
+/// of an enemy which changes whenever another enemy is removed. The generation is bumped each time a slot is freed, so a handle to a
+/// destroyed enemy never matches the enemy that later reuses its slot.
+/// </summary>
+struct EnemyHandle
+{
+	/// <summary>
+	/// The slot of the enemy in the slot table.
+	/// </summary>
+	sf::Uint32 slot;
+
+	/// <summary>
+	/// The generation of the slot when the enemy was spawned.
+	/// </summary>
+	sf::Uint32 generation;
+};
+
+/// <summary>
+/// Contiguous structure-of-arrays storage for all ghost enemies in the swarm defense game. Every attribute of an enemy lives in its own array
+/// so the per-frame loops only touch the memory they need.
+/// </summary>
+class EnemyStore
+{
+public:
+	/// <summary>
+	/// Initializes an empty store.
+	/// </summary>
+	EnemyStore();
+
+	~EnemyStore();
+
+	/// <summary>
+	/// Creates a new enemy at a random spot just outside the screen.
+	/// </summary>
+	/// <param name="vm">The video mode that will render the enemy.</param>
+	/// <param name="random">The random stream the spot is drawn from.</param>
+	/// <returns>The handle of the new enemy.</returns>
+	EnemyHandle spawn(sf::VideoMode vm, RandomStream& random);
+
+	/// <summary>
+	/// Removes the enemy with the provided handle in constant time by moving the last enemy into its place.
+	/// </summary>
+	/// <param name="handle">The handle of the enemy to remove.</param>
+	/// <returns>True if the enemy existed and was removed. False if the handle is stale or was never issued by this store.</returns>
+	bool destroy(EnemyHandle handle);
+
+	/// <summary>
+	/// Returns true if the enemy with the provided handle is still in this store.
+	/// </summary>
+	/// <param name="handle">The handle of the enemy.</param>
+	/// <returns>True if the enemy with the provided handle is still in this store.</returns>
+	bool contains(EnemyHandle handle) const;
+
+	/// <summary>
+	/// Finds the current index of the enemy with the provided handle in constant time.
+	/// </summary>
+	/// <param name="handle">The handle of the enemy.</param>
+	/// <param name="index">Set to the index of the enemy if found.</param>
+	/// <returns>True if the enemy was found.</returns>
+	bool findIndex(EnemyHandle handle, std::size_t& index) const;
+
+	/// <summary>
+	/// Gets the number of enemies currently stored.
+	/// </summary>
+	/// <returns>The number of enemies currently stored.</returns>
+	std::size_t size() const;
+
+	/// <summary>
+	/// Returns true if there are no enemies stored.
+	/// </summary>
+	/// <returns>True if there are no enemies stored.</returns>
+	bool empty() const;
+
+	/// <summary>
+	/// Gets the handle of the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <returns>The handle of the enemy at the provided index.</returns>
+	EnemyHandle getHandle(std::size_t index) const;
+
+	/// <summary>
+	/// Gets the coordinates of the center of the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <returns>The coordinates of the center of the enemy.</returns>
+	sf::Vector2f getCenterCoordinates(std::size_t index) const;
+
+	/// <summary>
+	/// Gets the number of enemies that can be targeted, which is every enemy that is not dying.
+	/// </summary>
+	/// <returns>The number of enemies that can be targeted.</returns>
+	std::size_t getTargetableCount() const;
+
+	/// <summary>
+	/// Gets the index of a targetable enemy in constant time. The order of the targetable enemies changes whenever one is removed.
+	/// </summary>
+	/// <param name="targetable">Which targetable enemy to get, from 0 to getTargetableCount() - 1.</param>
+	/// <returns>The index of the enemy.</returns>
+	std::size_t getTargetableIndex(std::size_t targetable) const;
+
+	/// <summary>
+	/// Finds the targetable enemy closest to the point the enemies advance towards in constant time. Every moving enemy covers the same
+	/// distance each tick, so the order in which they arrive is fixed when they spawn and is kept sorted as they spawn and die.
+	/// </summary>
+	/// <param name="index">Set to the index of the closest enemy if there is one.</param>
+	/// <returns>True if there is a targetable enemy.</returns>
+	bool findClosestTarget(std::size_t& index) const;
+
+	/// <summary>
+	/// Finds the targetable enemies closest to the point the enemies advance towards, closest first, in time proportional to the number
+	/// found.
+	/// </summary>
+	/// <param name="count">The most enemies to find.</param>
+	/// <param name="indices">The vector the indices of the enemies are appended to.</param>
+	/// <returns>The number of enemies found, which is less than count if there are fewer targetable enemies.</returns>
+	std::size_t findClosestTargets(std::size_t count, std::vector<std::size_t>& indices) const;
+
+	/// <summary>
+	/// Gets the dimensions every enemy is spawned with. No animation frame makes an enemy wider or taller than this.
+	/// </summary>
+	/// <param name="vm">The video mode that will render the enemies.</param>
+	/// <returns>The width and height of a newly spawned enemy.</returns>
+	static sf::Vector2f getBaseDimensions(sf::VideoMode vm);
+
+	/// <summary>
+	/// Gets the axis-aligned bounding box of the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <returns>The bounding box of the enemy.</returns>
+	AABB getBounds(std::size_t index) const;
+
+	/// <summary>
+	/// Replaces the contents of the provided list with the bounding boxes of the enemies at the provided indices, in the same order, so
+	/// they can be tested together with AABB::overlaps.
+	/// </summary>
+	/// <param name="indices">A pointer to the first index.</param>
+	/// <param name="count">The number of indices.</param>
+	/// <param name="bounds">The list to fill.</param>
+	void gatherBounds(const sf::Uint32* indices, std::size_t count, std::vector<AABB>& bounds) const;
+
+	/// <summary>
+	/// Returns true if the provided flag is set on the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <param name="flag">The flag to check.</param>
+	/// <returns>True if the flag is set.</returns>
+	bool hasFlag(std::size_t index, EnemyFlag flag) const;
+
+	/// <summary>
+	/// Initiates the dying process of the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	void die(std::size_t index);
+
+	/// <summary>
+	/// Initiates the attacking process of the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	void attack(std::size_t index);
+
+	/// <summary>
+	/// Adds the provided time to the frame timer of every enemy and steps each enemy whose frame period has run out to its next frame,
+	/// looking the frame, any new flags and any resize up in the ghost animation table.
+	/// </summary>
+	/// <param name="timeElapsed">The time in microseconds that has elapsed since the last iteration.</param>
+	void advanceAnimations(sf::Int64 timeElapsed);
+
+	/// <summary>
+	/// Advances the animation of every enemy, splitting the enemies between the threads of the provided pool. Gives the same result as
+	/// advancing them on one thread.
+	/// </summary>
+	/// <param name="timeElapsed">The time in microseconds that has elapsed since the last iteration.</param>
+	/// <param name="workers">The pool of threads to advance the animations on.</param>
+	void advanceAnimations(sf::Int64 timeElapsed, WorkerPool& workers);
+
+	/// <summary>
+	/// Shifts every enemy that is neither dying nor attacking towards the provided coordinate by the provided number of pixels. Enemies
+	/// always advance towards the center of the screen they were spawned for.
+	/// </summary>
+	/// <param name="x">The x-axis coordinate.</param>
+	/// <param name="y">The y-axis coordinate.</param>
+	/// <param name="distanceToShift">The number of pixels to shift.</param>
+	void advanceTowards(float x, float y, float distanceToShift);
+
+	/// <summary>
+	/// Shifts every enemy that is neither dying nor attacking towards the provided coordinate by the provided number of pixels, splitting
+	/// the enemies between the threads of the provided pool. Gives the same result as advancing them on one thread.
+	/// </summary>
+	/// <param name="x">The x-axis coordinate.</param>
+	/// <param name="y">The y-axis coordinate.</param>
+	/// <param name="distanceToShift">The number of pixels to shift.</param>
+	/// <param name="workers">The pool of threads to advance the enemies on.</param>
+	void advanceTowards(float x, float y, float distanceToShift, WorkerPool& workers);
+
+	/// <summary>
+	/// Copies the current position of every enemy into its previous position. Called at the start of each simulation tick so rendering
+	/// can interpolate between the two.
+	/// </summary>
+	void storePreviousPositions();
+
+	/// <summary>
+	/// Replaces the contents of the provided list with a snapshot of every enemy, in index order. Keeps the capacity of the
+	/// list, so refilling it each tick does not allocate once it has grown to the size of the swarm.
+	/// </summary>
+	/// <param name="ghosts">The list to fill.</param>
+	void writeSnapshots(std::vector<GhostSnapshot>& ghosts) const;
+
+private:
+	/// <summary>
+	/// The handle of each enemy.
+	/// </summary>
+	std::vector<EnemyHandle> handles;
+
+	/// <summary>
+	/// The x-axis coordinate of the center of each enemy.
+	/// </summary>
+	std::vector<float> positionX;
+
+	/// <summary>
+	/// The y-axis coordinate of the center of each enemy.
+	/// </summary>
+	std::vector<float> positionY;
+
+	/// <summary>
+	/// The x-axis coordinate of the center of each enemy at the start of the current tick.
+	/// </summary>
+	std::vector<float> previousPositionX;
+
+	/// <summary>
+	/// The y-axis coordinate of the center of each enemy at the start of the current tick.
+	/// </summary>
+	std::vector<float> previousPositionY;
+
+	/// <summary>
+	/// The width of each enemy in pixels.
+	/// </summary>
+	std::vector<float> width;
+
+	/// <summary>
+	/// The height of each enemy in pixels.
+	/// </summary>
+	std::vector<float> height;
+
+	/// <summary>
+	/// The x-axis origin used when rendering each enemy, relative to the top left of its texture.
+	/// </summary>
+	std::vector<float> originX;
+
+	/// <summary>
+	/// The y-axis origin used when rendering each enemy, relative to the top left of its texture.
+	/// </summary>
+	std::vector<float> originY;
+
+	/// <summary>
+	/// The current ghost animation texture frame of each enemy.
+	/// </summary>
+	std::vector<GhostAnimation> animation;
+
+	/// <summary>
+	/// The cumulative time elapsed of each enemy until its frame period is reached.
+	/// </summary>
+	std::vector<sf::Int64> microSecondsElapsed;
+
+	/// <summary>
+	/// The packed EnemyFlag bits of each enemy.
+	/// </summary>
+	std::vector<unsigned char> flags;
+
+	/// <summary>
+	/// The index of the enemy occupying each slot. Only meaningful for slots that are not on the free list.
+	/// </summary>
+	std::vector<sf::Uint32> slotIndex;
+
+	/// <summary>
+	/// The current generation of each slot.
+	/// </summary>
+	std::vector<sf::Uint32> slotGeneration;
+
+	/// <summary>
+	/// The slots that are free to be given to the next enemies spawned.
+	/// </summary>
+	std::vector<sf::Uint32> freeSlots;
+
+	/// <summary>
+	/// The position of each slot in targetableSlots, or notTargetable if the enemy in the slot is dying or the slot is free.
+	/// </summary>
+	std::vector<sf::Uint32> slotTargetablePosition;
+
+	/// <summary>
+	/// The total distance advanced by every enemy when each slot's enemy would reach the center of the screen, if it kept moving.
+	/// </summary>
+	std::vector<double> slotArrivalDistance;
+
+	/// <summary>
+	/// The slots of every enemy that is not dying, in no particular order.
+	/// </summary>
+	std::vector<sf::Uint32> targetableSlots;
+
+	/// <summary>
+	/// The arrival distance and slot of every enemy that is not dying, ordered from the first to arrive to the last.
+	/// </summary>
+	std::set<std::pair<double, sf::Uint32>> arrivalOrder;
+
+	/// <summary>
+	/// The total distance every moving enemy has advanced since the store was created.
+	/// </summary>
+	double distanceAdvanced;
+
+	/// <summary>
+	/// Shifts the enemies from the provided first index up to but not including the provided last index towards the provided coordinate.
+	/// </summary>
+	/// <param name="begin">The index of the first enemy to shift.</param>
+	/// <param name="end">One past the index of the last enemy to shift.</param>
+	/// <param name="x">The x-axis coordinate.</param>
+	/// <param name="y">The y-axis coordinate.</param>
+	/// <param name="distanceToShift">The number of pixels to shift.</param>
+	void advanceRangeTowards(std::size_t begin, std::size_t end, float x, float y, float distanceToShift);
+
+	/// <summary>
+	/// Stops the enemy in the provided slot from being targeted. Does nothing if it already cannot be targeted.
+	/// </summary>
+	/// <param name="slot">The slot of the enemy.</param>
+	void removeTarget(sf::Uint32 slot);
+
+	/// <summary>
+	/// Sets the provided flag on the enemy at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <param name="flag">The flag to set.</param>
+	void setFlag(std::size_t index, EnemyFlag flag);
+
+	/// <summary>
+	/// Advances the animation of the enemies from the provided first index up to but not including the provided last index.
+	/// </summary>
+	/// <param name="begin">The index of the first enemy to animate.</param>
+	/// <param name="end">One past the index of the last enemy to animate.</param>
+	/// <param name="timeElapsed">The time in microseconds that has elapsed since the last iteration.</param>
+	void advanceAnimationRange(std::size_t begin, std::size_t end, sf::Int64 timeElapsed);
+
+	/// <summary>
+	/// Updates the dimensions of the enemy at the provided index to account for a different sprite size, keeping the rendered sprite in place.
+	/// </summary>
+	/// <param name="index">The index of the enemy.</param>
+	/// <param name="dimensions">The new dimensions of the enemy.</param>
+	/// <param name="originOffset">The offset of the new origin from the center of the sprite.</param>
+	void updateDimensions(std::size_t index, sf::Vector2f dimensions, sf::Vector2f originOffset);
+};
+
+#endif // !ENEMY_STORE_H
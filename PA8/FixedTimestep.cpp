@@ -0,0 +1,44 @@
+#include "FixedTimestep.h"
+
+FixedTimestep::FixedTimestep(unsigned int ticksPerSecond, unsigned int maxTicksPerFrame)
+{
+	tickMicroseconds = 1000000 / std::max(ticksPerSecond, 1u);
+	maxTicks = std::max(maxTicksPerFrame, 1u);
+	accumulator = 0;
+	droppedMicroseconds = 0;
+}
+
+FixedTimestep::~FixedTimestep()
+{
+}
+
+unsigned int FixedTimestep::advance(sf::Int64 elapsedMicroseconds)
+{
+	accumulator += std::max(elapsedMicroseconds, (sf::Int64)0);
+
+	sf::Int64 maxAccumulated = tickMicroseconds * maxTicks;
+	if (accumulator >= maxAccumulated + tickMicroseconds)
+	{
+		droppedMicroseconds += accumulator - maxAccumulated;
+		accumulator = maxAccumulated;
+	}
+
+	unsigned int ticks = (unsigned int)(accumulator / tickMicroseconds);
+	accumulator -= ticks * tickMicroseconds;
+	return ticks;
+}
+
+float FixedTimestep::getInterpolation() const
+{
+	return (float)accumulator / (float)tickMicroseconds;
+}
+
+sf::Int64 FixedTimestep::getTickMicroseconds() const
+{
+	return tickMicroseconds;
+}
+
+sf::Int64 FixedTimestep::getDroppedMicroseconds() const
+{
+	return droppedMicroseconds;
+}
@@ -0,0 +1,71 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include <SFML/System.hpp>
+#include <algorithm>
+
+/// <summary>
+/// Turns the real time elapsed between frames into a whole number of fixed-length simulation ticks. The time left over after the last
+/// tick is carried into the next frame and exposed as an interpolation factor so rendering can blend the previous and current states.
+/// </summary>
+class FixedTimestep
+{
+public:
+	/// <summary>
+	/// Initializes the tick length and the cap on ticks per frame.
+	/// </summary>
+	/// <param name="ticksPerSecond">The number of simulation ticks per second of real time.</param>
+	/// <param name="maxTicksPerFrame">The most ticks run in a single frame. Time beyond this is dropped so a slow frame cannot cause an
+	/// ever growing backlog of ticks.</param>
+	FixedTimestep(unsigned int ticksPerSecond, unsigned int maxTicksPerFrame);
+
+	~FixedTimestep();
+
+	/// <summary>
+	/// Adds the provided real time to the accumulator and removes the time of every whole tick it now holds.
+	/// </summary>
+	/// <param name="elapsedMicroseconds">The real time in microseconds since the last call.</param>
+	/// <returns>The number of ticks to run this frame, never more than the cap.</returns>
+	unsigned int advance(sf::Int64 elapsedMicroseconds);
+
+	/// <summary>
+	/// Gets how far the accumulator is into the next tick.
+	/// </summary>
+	/// <returns>A value from 0 up to but not including 1.</returns>
+	float getInterpolation() const;
+
+	/// <summary>
+	/// Gets the simulated time of each tick.
+	/// </summary>
+	/// <returns>The length of a tick in microseconds.</returns>
+	sf::Int64 getTickMicroseconds() const;
+
+	/// <summary>
+	/// Gets the total real time dropped because a frame needed more ticks than the cap.
+	/// </summary>
+	/// <returns>The dropped time in microseconds.</returns>
+	sf::Int64 getDroppedMicroseconds() const;
+
+private:
+	/// <summary>
+	/// The length of a tick in microseconds.
+	/// </summary>
+	sf::Int64 tickMicroseconds;
+
+	/// <summary>
+	/// The most ticks run in a single frame.
+	/// </summary>
+	unsigned int maxTicks;
+
+	/// <summary>
+	/// The real time in microseconds not yet consumed by a tick.
+	/// </summary>
+	sf::Int64 accumulator;
+
+	/// <summary>
+	/// The total real time in microseconds dropped by the cap.
+	/// </summary>
+	sf::Int64 droppedMicroseconds;
+};
+
+#endif // !FIXED_TIMESTEP_H
@@ -0,0 +1,194 @@
+#include "FontAtlas.h"
+
+// The characters held by the atlas: printable ASCII.
+const static sf::Uint32 firstCharacter = 32;
+const static sf::Uint32 lastCharacter = 126;
+const static sf::Uint32 characterCount = lastCharacter - firstCharacter + 1;
+// The empty border sf::Font leaves around each glyph in its textures. Copied along with the glyph so smoothing does not pull in a neighbor.
+const static int glyphPadding = 2;
+const static unsigned int maxAtlasWidth = 2048;
+// The space sf::Text leaves around each glyph quad so smoothing does not cut off its edges.
+const static float quadPadding = 1.0f;
+
+FontAtlas::FontAtlas()
+{
+}
+
+FontAtlas::~FontAtlas()
+{
+}
+
+bool FontAtlas::load(const std::string& fontPath)
+{
+	return load(fontPath, getStandardFaces());
+}
+
+bool FontAtlas::load(const std::string& fontPath, const std::vector<FontFace>& faces)
+{
+	faceGlyphs.clear();
+
+	sf::Font font;
+	if (!font.loadFromFile(fontPath))
+	{
+		std::cout << "Failed to load font " << fontPath << "." << std::endl;
+		return false;
+	}
+
+	// Rasterise every glyph before copying any, since adding glyphs to a size can grow the font's texture for that size.
+	for (std::size_t i = 0; i < faces.size(); i++)
+	{
+		FaceGlyphs face;
+		face.face = faces[i];
+		face.lineSpacing = font.getLineSpacing(faces[i].characterSize);
+		face.glyphs.resize(characterCount);
+		for (sf::Uint32 character = 0; character < characterCount; character++)
+		{
+			face.glyphs[character] = font.getGlyph(firstCharacter + character, faces[i].characterSize, false, faces[i].outlineThickness);
+		}
+
+		face.kerning.resize(characterCount * characterCount);
+		for (sf::Uint32 first = 0; first < characterCount; first++)
+		{
+			for (sf::Uint32 second = 0; second < characterCount; second++)
+			{
+				face.kerning[first * characterCount + second] = font.getKerning(firstCharacter + first, firstCharacter + second, faces[i].characterSize);
+			}
+		}
+
+		faceGlyphs.push_back(face);
+	}
+
+	std::vector<sf::Vector2u> paddedSizes;
+	for (std::size_t i = 0; i < faceGlyphs.size(); i++)
+	{
+		for (sf::Uint32 character = 0; character < characterCount; character++)
+		{
+			const sf::IntRect& rect = faceGlyphs[i].glyphs[character].textureRect;
+			bool isEmpty = rect.width <= 0 || rect.height <= 0;
+			paddedSizes.push_back(isEmpty ? sf::Vector2u(0, 0) : sf::Vector2u(rect.width + 2 * glyphPadding, rect.height + 2 * glyphPadding));
+		}
+	}
+
+	std::vector<sf::IntRect> packedRects;
+	sf::Vector2u atlasSize = TextureAtlas::pack(paddedSizes, maxAtlasWidth, packedRects);
+	sf::Image atlasImage;
+	atlasImage.create(std::max(atlasSize.x, 1u), std::max(atlasSize.y, 1u), sf::Color(255, 255, 255, 0));
+
+	std::map<unsigned int, sf::Image> fontImages;
+	std::size_t packedIndex = 0;
+	for (std::size_t i = 0; i < faceGlyphs.size(); i++)
+	{
+		unsigned int characterSize = faceGlyphs[i].face.characterSize;
+		if (fontImages.find(characterSize) == fontImages.end())
+		{
+			fontImages[characterSize] = font.getTexture(characterSize).copyToImage();
+		}
+
+		for (sf::Uint32 character = 0; character < characterCount; character++, packedIndex++)
+		{
+			sf::IntRect& rect = faceGlyphs[i].glyphs[character].textureRect;
+			if (paddedSizes[packedIndex].x == 0) continue;
+
+			const sf::IntRect& packed = packedRects[packedIndex];
+			sf::IntRect paddedRect(rect.left - glyphPadding, rect.top - glyphPadding, rect.width + 2 * glyphPadding, rect.height + 2 * glyphPadding);
+			atlasImage.copy(fontImages[characterSize], packed.left, packed.top, paddedRect);
+			rect = sf::IntRect(packed.left + glyphPadding, packed.top + glyphPadding, rect.width, rect.height);
+		}
+	}
+
+	if (!texture.loadFromImage(atlasImage))
+	{
+		std::cout << "Failed to create the texture of font atlas " << fontPath << "." << std::endl;
+		faceGlyphs.clear();
+		return false;
+	}
+
+	texture.setSmooth(true);
+	return true;
+}
+
+bool FontAtlas::getGlyph(sf::Uint32 character, unsigned int characterSize, float outlineThickness, sf::Glyph& glyph) const
+{
+	if (character < firstCharacter || character > lastCharacter) return false;
+
+	const FaceGlyphs* face = findFace(characterSize, outlineThickness);
+	if (face == nullptr) return false;
+
+	glyph = face->glyphs[character - firstCharacter];
+	return true;
+}
+
+float FontAtlas::getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const
+{
+	if (first < firstCharacter || first > lastCharacter || second < firstCharacter || second > lastCharacter) return 0.0f;
+
+	const FaceGlyphs* face = findSize(characterSize);
+	if (face == nullptr) return 0.0f;
+
+	return face->kerning[(first - firstCharacter) * characterCount + (second - firstCharacter)];
+}
+
+float FontAtlas::getLineSpacing(unsigned int characterSize) const
+{
+	const FaceGlyphs* face = findSize(characterSize);
+	if (face == nullptr) return (float)characterSize;
+
+	return face->lineSpacing;
+}
+
+const sf::Texture& FontAtlas::getTexture() const
+{
+	return texture;
+}
+
+std::vector<FontFace> FontAtlas::getStandardFaces()
+{
+	std::vector<FontFace> faces;
+	const unsigned int characterSizes[] = { 18, 20, 25, 30, 50, 75, 100 };
+	for (unsigned int characterSize : characterSizes)
+	{
+		faces.push_back(FontFace{ characterSize, 0.0f });
+	}
+
+	// The outlined HUD counters.
+	faces.push_back(FontFace{ 50, 1.0f });
+	return faces;
+}
+
+void FontAtlas::addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f pen, const sf::Glyph& glyph, sf::Color color, float outlineThickness)
+{
+	float left = pen.x + glyph.bounds.left - quadPadding - outlineThickness;
+	float top = pen.y + glyph.bounds.top - quadPadding - outlineThickness;
+	float right = pen.x + glyph.bounds.left + glyph.bounds.width + quadPadding - outlineThickness;
+	float bottom = pen.y + glyph.bounds.top + glyph.bounds.height + quadPadding - outlineThickness;
+
+	float textureLeft = (float)glyph.textureRect.left - quadPadding;
+	float textureRight = (float)(glyph.textureRect.left + glyph.textureRect.width) + quadPadding;
+	float textureTop = (float)glyph.textureRect.top - quadPadding;
+	float textureBottom = (float)(glyph.textureRect.top + glyph.textureRect.height) + quadPadding;
+
+	vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(textureLeft, textureTop)));
+	vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(textureRight, textureTop)));
+	vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(textureRight, textureBottom)));
+	vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(textureLeft, textureBottom)));
+}
+
+const FontAtlas::FaceGlyphs* FontAtlas::findFace(unsigned int characterSize, float outlineThickness) const
+{
+	for (std::size_t i = 0; i < faceGlyphs.size(); i++)
+	{
+		if (faceGlyphs[i].face.characterSize == characterSize && faceGlyphs[i].face.outlineThickness == outlineThickness) return &faceGlyphs[i];
+	}
+
+	return nullptr;
+}
+
+const FontAtlas::FaceGlyphs* FontAtlas::findSize(unsigned int characterSize) const
+{
+	for (std::size_t i = 0; i < faceGlyphs.size(); i++)
+	{
+		if (faceGlyphs[i].face.characterSize == characterSize) return &faceGlyphs[i];
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,158 @@
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include "TextureAtlas.h"
+
+/// <summary>
+/// A character size and outline thickness that a font atlas holds glyphs for.
+/// </summary>
+struct FontFace
+{
+	/// <summary>
+	/// The character size in pixels.
+	/// </summary>
+	unsigned int characterSize;
+
+	/// <summary>
+	/// The thickness of the outline the glyphs are rendered with, or 0 for fill glyphs.
+	/// </summary>
+	float outlineThickness;
+};
+
+/// <summary>
+/// The printable ASCII glyphs of a font, rasterised once at a fixed set of faces and packed into a single texture. Text components build
+/// their quads from the metrics handed out here and all draw with the same texture, so loading a screen does not rasterise anything and
+/// the font itself is released once the atlas is built. Characters and faces outside the set have no glyph.
+/// </summary>
+class FontAtlas
+{
+public:
+	/// <summary>
+	/// Initializes an empty atlas with no faces.
+	/// </summary>
+	FontAtlas();
+
+	~FontAtlas();
+
+	/// <summary>
+	/// Rasterises the standard faces of the font at the provided path into the atlas.
+	/// </summary>
+	/// <param name="fontPath">The path of the font file.</param>
+	/// <returns>True if the font was loaded.</returns>
+	bool load(const std::string& fontPath);
+
+	/// <summary>
+	/// Rasterises the provided faces of the font at the provided path into the atlas, replacing anything loaded before.
+	/// </summary>
+	/// <param name="fontPath">The path of the font file.</param>
+	/// <param name="faces">The faces to rasterise.</param>
+	/// <returns>True if the font was loaded.</returns>
+	bool load(const std::string& fontPath, const std::vector<FontFace>& faces);
+
+	/// <summary>
+	/// Gets the glyph of a character in the provided face. The texture rectangle of the glyph is in the atlas texture.
+	/// </summary>
+	/// <param name="character">The character.</param>
+	/// <param name="characterSize">The character size of the face.</param>
+	/// <param name="outlineThickness">The outline thickness of the face, or 0 for fill glyphs.</param>
+	/// <param name="glyph">Set to the glyph if it is in the atlas.</param>
+	/// <returns>True if the atlas holds the character in the provided face.</returns>
+	bool getGlyph(sf::Uint32 character, unsigned int characterSize, float outlineThickness, sf::Glyph& glyph) const;
+
+	/// <summary>
+	/// Gets the offset to apply between two consecutive characters of the provided size.
+	/// </summary>
+	/// <param name="first">The character before.</param>
+	/// <param name="second">The character after.</param>
+	/// <param name="characterSize">The character size.</param>
+	/// <returns>The kerning offset in pixels, or 0 if either character or the size is not in the atlas.</returns>
+	float getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const;
+
+	/// <summary>
+	/// Gets the distance between two lines of text of the provided size.
+	/// </summary>
+	/// <param name="characterSize">The character size.</param>
+	/// <returns>The line spacing in pixels, or the character size if the size is not in the atlas.</returns>
+	float getLineSpacing(unsigned int characterSize) const;
+
+	/// <summary>
+	/// Gets the texture holding every glyph.
+	/// </summary>
+	/// <returns>The atlas texture.</returns>
+	const sf::Texture& getTexture() const;
+
+	/// <summary>
+	/// Gets the faces rasterised by load when none are given: every character size used by the menus, modals and HUD.
+	/// </summary>
+	/// <returns>The standard faces.</returns>
+	static std::vector<FontFace> getStandardFaces();
+
+	/// <summary>
+	/// Adds the quad of a glyph to the provided vertex array, laid out the way sf::Text lays out its quads.
+	/// </summary>
+	/// <param name="vertices">The vertex array to add the quad to.</param>
+	/// <param name="pen">The position of the pen on the baseline when the glyph is drawn.</param>
+	/// <param name="glyph">The glyph to add.</param>
+	/// <param name="color">The color of the quad.</param>
+	/// <param name="outlineThickness">The outline thickness the glyph was rendered with, or 0 for a fill glyph.</param>
+	static void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f pen, const sf::Glyph& glyph, sf::Color color, float outlineThickness);
+
+private:
+	/// <summary>
+	/// The glyphs and metrics of one face.
+	/// </summary>
+	struct FaceGlyphs
+	{
+		/// <summary>
+		/// The face the glyphs were rasterised for.
+		/// </summary>
+		FontFace face;
+
+		/// <summary>
+		/// The distance between two lines of text.
+		/// </summary>
+		float lineSpacing;
+
+		/// <summary>
+		/// The glyph of each character, indexed from the first character of the set.
+		/// </summary>
+		std::vector<sf::Glyph> glyphs;
+
+		/// <summary>
+		/// The kerning of each pair of characters, indexed by the first character times the set size plus the second.
+		/// </summary>
+		std::vector<float> kerning;
+	};
+
+	/// <summary>
+	/// The texture holding every glyph.
+	/// </summary>
+	sf::Texture texture;
+
+	/// <summary>
+	/// The glyphs of each face.
+	/// </summary>
+	std::vector<FaceGlyphs> faceGlyphs;
+
+	/// <summary>
+	/// Finds the glyphs of a face.
+	/// </summary>
+	/// <param name="characterSize">The character size of the face.</param>
+	/// <param name="outlineThickness">The outline thickness of the face.</param>
+	/// <returns>The glyphs of the face, or nullptr if it is not in the atlas.</returns>
+	const FaceGlyphs* findFace(unsigned int characterSize, float outlineThickness) const;
+
+	/// <summary>
+	/// Finds the glyphs of any face of the provided size, for the metrics that do not depend on the outline.
+	/// </summary>
+	/// <param name="characterSize">The character size.</param>
+	/// <returns>The glyphs of a face of the provided size, or nullptr if there is none.</returns>
+	const FaceGlyphs* findSize(unsigned int characterSize) const;
+};
+
+#endif // !FONT_ATLAS_H
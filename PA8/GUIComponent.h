@@ -3,15 +3,16 @@
 
 #include "MoveableComponent.h"
 #include <SFML/Graphics.hpp>
+#include "ResourceCache.h"
 
 /// <summary>
-/// A base class used to inherit textures.
+/// A base class used to inherit textures. The textures are shared by every GUI component through the resource cache.
 /// </summary>
 class GUIComponent : public MoveableComponent
 {
 public:
 	/// <summary>
-	/// Loads all textures.
+	/// Gets all textures from the shared resource cache.
 	/// </summary>
 	GUIComponent();
 
@@ -19,72 +20,38 @@ protected:
 	/// <summary>
 	/// The base texture that contains all GUI textures.
 	/// </summary>
-	sf::Texture baseTexture;
+	std::shared_ptr<const sf::Texture> baseTexture;
 
 	/// <summary>
-	/// The texture for the top double line border.
+	/// The atlas holding the corner border images, named after their files: top_left_double_border, top_right_double_border,
+	/// bottom_left_double_border, bottom_right_double_border and the same four with single in place of double.
 	/// </summary>
-	sf::Texture topDoubleBorder;
+	std::shared_ptr<const TextureAtlas> guiAtlas;
 
 	/// <summary>
-	/// The texture for the bottom double line border.
-	/// </summary>
-	sf::Texture bottomDoubleBorder;
-
-	/// <summary>
-	/// The texture for the top left corner double line border.
-	/// </summary>
-	sf::Texture topLeftDoubleBorder;
-
-	/// <summary>
-	/// The texture for the bottom left corner double line border.
-	/// </summary>
-	sf::Texture bottomLeftDoubleBorder;
-
-	/// <summary>
-	/// The texture for the top right corner double line border.
+	/// The texture for the top double line border. The long borders are kept out of the atlas because they repeat.
 	/// </summary>
-	sf::Texture topRightDoubleBorder;
+	std::shared_ptr<const sf::Texture> topDoubleBorder;
 
 	/// <summary>
-	/// The texture for the bottom right corner double line border.
+	/// The texture for the bottom double line border.
 	/// </summary>
-	sf::Texture bottomRightDoubleBorder;
+	std::shared_ptr<const sf::Texture> bottomDoubleBorder;
 
 	/// <summary>
 	/// The texture for the left double line border.
 	/// </summary>
-	sf::Texture leftDoubleBorder;
+	std::shared_ptr<const sf::Texture> leftDoubleBorder;
 
 	/// <summary>
 	/// The texture for the right double line border.
 	/// </summary>
-	sf::Texture rightDoubleBorder;
+	std::shared_ptr<const sf::Texture> rightDoubleBorder;
 
 	/// <summary>
 	/// The texture for the modal background.
 	/// </summary>
-	sf::Texture modalBackground;
-
-	/// <summary>
-	/// The texture for the top left corner single line border.
-	/// </summary>
-	sf::Texture topLeftSingleBorder;
-
-	/// <summary>
-	/// The texture for the bottom left corner single line border.
-	/// </summary>
-	sf::Texture bottomLeftSingleBorder;
-
-	/// <summary>
-	/// The texture for the top right corner single line border.
-	/// </summary>
-	sf::Texture topRightSingleBorder;
-
-	/// <summary>
-	/// The texture for the bottom right single line border.
-	/// </summary>
-	sf::Texture bottomRightSingleBorder;
+	std::shared_ptr<const sf::Texture> modalBackground;
 
 	/// <summary>
 	/// Constant representing the length of each side of the square that makes up the texture of a corner double line border in pixels.
@@ -0,0 +1,13 @@
+#ifndef GHOST_ANIMATION_TRACK_H
+#define GHOST_ANIMATION_TRACK_H
+
+/// <summary>
+/// Enum representing which sequence of frames a ghost is playing, chosen from its flags. Dying takes priority over attacking.
+/// </summary>
+enum class GhostAnimationTrack
+{
+	Idle = 0,
+	Attacking = 1,
+	Dying = 2
+};
+#endif // !GHOST_ANIMATION_TRACK_H
@@ -0,0 +1,47 @@
+#ifndef GHOST_FRAME_STEP_H
+#define GHOST_FRAME_STEP_H
+
+#include "GhostAnimation.h"
+
+/// <summary>
+/// What happens to a ghost when the frame period of its track runs out while it shows a given frame: the frame it moves to, the flags it
+/// gains and how its sprite is resized.
+/// </summary>
+struct GhostFrameStep
+{
+	/// <summary>
+	/// The frame shown next.
+	/// </summary>
+	GhostAnimation next;
+
+	/// <summary>
+	/// The EnemyFlag bits set on the ghost.
+	/// </summary>
+	unsigned char flagsToSet;
+
+	/// <summary>
+	/// True if the next frame is a different size, in which case the fields below apply.
+	/// </summary>
+	bool resizes;
+
+	/// <summary>
+	/// The new width as a fraction of the current width.
+	/// </summary>
+	float widthScale;
+
+	/// <summary>
+	/// The new height as a fraction of the current height.
+	/// </summary>
+	float heightScale;
+
+	/// <summary>
+	/// The x-axis offset of the new origin from the center of the sprite, as a fraction of the current width.
+	/// </summary>
+	float originOffsetX;
+
+	/// <summary>
+	/// The y-axis offset of the new origin from the center of the sprite, as a fraction of the current height.
+	/// </summary>
+	float originOffsetY;
+};
+#endif // !GHOST_FRAME_STEP_H
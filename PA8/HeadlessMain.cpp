@@ -0,0 +1,8 @@
+#include <iostream>
+#include "HeadlessRunner.h"
+
+int main(int argc, char* argv[])
+{
+    HeadlessRunner runner(argc, argv);
+    return runner.run();
+}
@@ -0,0 +1,232 @@
+#include "HeadlessRunner.h"
+
+HeadlessRunner::HeadlessRunner(int argc, char* argv[])
+{
+	ticks = 3600;
+	tickMicroseconds = 16667;
+	videoMode = sf::VideoMode(1920, 1080);
+	seed = 1;
+	threadCount = 1;
+	hasError = false;
+	isShowingHelp = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string option = argv[i];
+		if (option == "--help")
+		{
+			isShowingHelp = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			std::cout << "Missing value for option " << option << std::endl;
+			hasError = true;
+			return;
+		}
+
+		std::string value = argv[++i];
+		try
+		{
+			if (option == "--ticks")
+			{
+				ticks = std::stoul(value);
+			}
+			else if (option == "--tick-us")
+			{
+				tickMicroseconds = std::stoll(value);
+			}
+			else if (option == "--width")
+			{
+				videoMode.width = std::stoul(value);
+			}
+			else if (option == "--height")
+			{
+				videoMode.height = std::stoul(value);
+			}
+			else if (option == "--script")
+			{
+				if (!loadScript(value)) hasError = true;
+			}
+			else if (option == "--profile")
+			{
+				profilePath = value;
+			}
+			else if (option == "--seed")
+			{
+				seed = std::stoull(value);
+			}
+			else if (option == "--threads")
+			{
+				threadCount = std::stoul(value);
+			}
+			else {
+				std::cout << "Unknown option " << option << std::endl;
+				hasError = true;
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			std::cout << "Invalid value for option " << option << ": " << ex.what() << std::endl;
+			hasError = true;
+		}
+	}
+}
+
+HeadlessRunner::~HeadlessRunner()
+{
+}
+
+int HeadlessRunner::run()
+{
+	if (isShowingHelp)
+	{
+		printUsage();
+		return hasError ? EXIT_FAILURE : EXIT_SUCCESS;
+	}
+
+	if (hasError)
+	{
+		std::cout << "Run with --help to list the options." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Profiler::getInstance().setIsEnabled(!profilePath.empty());
+	SwarmSimulation simulation(videoMode, false, nullptr, nullptr, nullptr, seed);
+	simulation.setThreadCount(threadCount);
+	std::size_t nextInput = 0;
+	sf::Int64 slowestTick = 0;
+	unsigned long tick = 0;
+	sf::Clock totalClock;
+	sf::Clock tickClock;
+
+	for (; tick < ticks && !simulation.getIsGameOver(); tick++)
+	{
+		while (nextInput < script.size() && script[nextInput].tick <= tick)
+		{
+			apply(simulation, script[nextInput++]);
+		}
+
+		tickClock.restart();
+		simulation.step(tickMicroseconds);
+		slowestTick = std::max(slowestTick, tickClock.getElapsedTime().asMicroseconds());
+	}
+
+	sf::Int64 totalMicroseconds = totalClock.getElapsedTime().asMicroseconds();
+	std::cout << "seed=" << seed << std::endl;
+	std::cout << "ticks=" << tick << std::endl;
+	std::cout << "simulated_seconds=" << (tick * tickMicroseconds) / 1000000.0 << std::endl;
+	std::cout << "score=" << simulation.getScore() << std::endl;
+	std::cout << "coins=" << simulation.getCoins() << std::endl;
+	std::cout << "health=" << simulation.getHealth() << std::endl;
+	std::cout << "game_over=" << (simulation.getIsGameOver() ? "true" : "false") << std::endl;
+	std::cout << "enemies=" << simulation.getEnemies().size() << std::endl;
+	ProjectilePoolStats projectileStats = simulation.getProjectiles().getStats();
+	std::cout << "projectiles=" << simulation.getProjectiles().size() << std::endl;
+	std::cout << "projectile_allocations=" << projectileStats.allocations << std::endl;
+	std::cout << "projectile_acquisitions=" << projectileStats.acquisitions << std::endl;
+	std::cout << "projectile_rejections=" << projectileStats.rejections << std::endl;
+	std::cout << "projectile_peak=" << projectileStats.peakActive << std::endl;
+	ProjectileLifetimeStats lifetimeStats = simulation.getProjectileLifetimeStats();
+	std::cout << "projectiles_hit=" << lifetimeStats.hits << std::endl;
+	std::cout << "projectiles_arrived=" << lifetimeStats.arrivals << std::endl;
+	std::cout << "projectiles_off_screen=" << lifetimeStats.offScreen << std::endl;
+	std::cout << "projectiles_expired=" << lifetimeStats.expirations << std::endl;
+	std::cout << "weapons=" << simulation.getWeaponCount() << std::endl;
+	std::cout << "total_ms=" << totalMicroseconds / 1000.0 << std::endl;
+	std::cout << "mean_us_per_tick=" << (tick > 0 ? (double)totalMicroseconds / tick : 0.0) << std::endl;
+	std::cout << "max_us_per_tick=" << slowestTick << std::endl;
+
+	if (!profilePath.empty() && !Profiler::getInstance().writeCsv(profilePath)) return EXIT_FAILURE;
+
+	return EXIT_SUCCESS;
+}
+
+void HeadlessRunner::printUsage()
+{
+	std::cout << "Options:" << std::endl
+		<< "  --ticks N        Ticks to simulate (default 3600)" << std::endl
+		<< "  --tick-us N      Simulated microseconds per tick (default 16667)" << std::endl
+		<< "  --width N        Screen width the match is laid out for (default 1920)" << std::endl
+		<< "  --height N       Screen height the match is laid out for (default 1080)" << std::endl
+		<< "  --seed N         Seed of the random streams (default 1)" << std::endl
+		<< "  --threads N      Threads the simulation steps on (default 1)" << std::endl
+		<< "  --script FILE    Inputs to replay, one \"tick fire x y\", \"tick buy cost [basic|seeking]\" or \"tick coins amount\" per line" << std::endl
+		<< "  --profile FILE   Write the time of each simulation section to FILE as CSV" << std::endl
+		<< "  --help           Print these options" << std::endl;
+}
+
+bool HeadlessRunner::loadScript(const std::string& path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		std::cout << "Failed to open script " << path << std::endl;
+		return false;
+	}
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.empty() || line[0] == '#') continue;
+
+		std::istringstream words(line);
+		ScriptedInput input;
+		input.first = 0;
+		input.second = 0;
+		input.weaponType = WeaponType::Basic;
+		if (!(words >> input.tick >> input.action >> input.first))
+		{
+			std::cout << "Failed to parse script line: " << line << std::endl;
+			return false;
+		}
+
+		if (input.action == "fire" && !(words >> input.second))
+		{
+			std::cout << "Missing y-axis coordinate in script line: " << line << std::endl;
+			return false;
+		}
+
+		std::string weaponName;
+		if (input.action == "buy" && words >> weaponName)
+		{
+			if (weaponName == "seeking")
+			{
+				input.weaponType = WeaponType::Seeking;
+			}
+			else if (weaponName != "basic")
+			{
+				std::cout << "Unknown weapon type in script line: " << line << std::endl;
+				return false;
+			}
+		}
+
+		if (input.action != "fire" && input.action != "buy" && input.action != "coins")
+		{
+			std::cout << "Unknown action in script line: " << line << std::endl;
+			return false;
+		}
+
+		script.push_back(input);
+	}
+
+	std::stable_sort(script.begin(), script.end(), [](const ScriptedInput& a, const ScriptedInput& b) { return a.tick < b.tick; });
+	return true;
+}
+
+void HeadlessRunner::apply(SwarmSimulation& simulation, const ScriptedInput& input)
+{
+	if (input.action == "fire")
+	{
+		simulation.fireProjectileAt(sf::Vector2f(input.first, input.second));
+	}
+	else if (input.action == "buy")
+	{
+		simulation.purchaseWeapon((unsigned int)input.first, input.weaponType);
+	}
+	else if (input.action == "coins")
+	{
+		simulation.addCoins((unsigned int)input.first);
+	}
+}
@@ -0,0 +1,137 @@
+#ifndef HEADLESS_RUNNER_H
+#define HEADLESS_RUNNER_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "SwarmSimulation.h"
+#include "Profiler.h"
+
+/// <summary>
+/// A single scripted input applied to a headless simulation at a given tick.
+/// </summary>
+struct ScriptedInput
+{
+	/// <summary>
+	/// The tick before which the input is applied.
+	/// </summary>
+	unsigned long tick;
+
+	/// <summary>
+	/// The action to perform: "fire", "buy" or "coins".
+	/// </summary>
+	std::string action;
+
+	/// <summary>
+	/// The first argument of the action: the x-axis coordinate to fire at, the cost of the weapon or the number of coins.
+	/// </summary>
+	float first;
+
+	/// <summary>
+	/// The second argument of the action: the y-axis coordinate to fire at.
+	/// </summary>
+	float second;
+
+	/// <summary>
+	/// The type of weapon to buy.
+	/// </summary>
+	WeaponType weaponType;
+};
+
+/// <summary>
+/// Runs the swarm defense simulation for a fixed number of ticks without a window, textures or audio, then prints the final state and
+/// timing as key=value lines. Used for soak and performance regression tests on machines without a display.
+/// </summary>
+class HeadlessRunner
+{
+public:
+	/// <summary>
+	/// Parses the command line options. Supported options are --ticks N, --tick-us N, --width N, --height N, --seed N, --threads N,
+	/// --script FILE and --profile FILE, which writes the time of each simulation section to FILE as CSV. The same seed and script replay
+	/// the same game on any number of threads. --help prints the options instead of running.
+	/// The script holds one input per line in the form "tick fire x y", "tick buy cost [basic|seeking]" or "tick coins amount". Lines
+	/// starting with # are ignored.
+	/// </summary>
+	/// <param name="argc">The number of arguments.</param>
+	/// <param name="argv">The arguments, starting with the program name.</param>
+	HeadlessRunner(int argc, char* argv[]);
+
+	~HeadlessRunner();
+
+	/// <summary>
+	/// Runs the simulation and prints the report to standard output.
+	/// </summary>
+	/// <returns>EXIT_SUCCESS, or EXIT_FAILURE if the options or the script could not be parsed.</returns>
+	int run();
+
+	/// <summary>
+	/// Prints the supported options to standard output.
+	/// </summary>
+	static void printUsage();
+
+private:
+	/// <summary>
+	/// The number of ticks to simulate.
+	/// </summary>
+	unsigned long ticks;
+
+	/// <summary>
+	/// The simulated time of each tick in microseconds.
+	/// </summary>
+	sf::Int64 tickMicroseconds;
+
+	/// <summary>
+	/// The video mode the simulation is laid out for.
+	/// </summary>
+	sf::VideoMode videoMode;
+
+	/// <summary>
+	/// The seed of the simulation's random streams.
+	/// </summary>
+	sf::Uint64 seed;
+
+	/// <summary>
+	/// The number of threads the simulation steps on.
+	/// </summary>
+	unsigned int threadCount;
+
+	/// <summary>
+	/// The scripted inputs sorted by tick.
+	/// </summary>
+	std::vector<ScriptedInput> script;
+
+	/// <summary>
+	/// The path to write the profile to. Empty if the simulation is not profiled.
+	/// </summary>
+	std::string profilePath;
+
+	/// <summary>
+	/// Is true if an option or the script could not be parsed.
+	/// </summary>
+	bool hasError;
+
+	/// <summary>
+	/// Is true if --help was passed, in which case run prints the options instead of running the simulation.
+	/// </summary>
+	bool isShowingHelp;
+
+	/// <summary>
+	/// Loads the scripted inputs from the provided file.
+	/// </summary>
+	/// <param name="path">The path of the script file.</param>
+	/// <returns>True if the script was loaded.</returns>
+	bool loadScript(const std::string& path);
+
+	/// <summary>
+	/// Applies the provided scripted input to the provided simulation.
+	/// </summary>
+	/// <param name="simulation">The simulation to apply the input to.</param>
+	/// <param name="input">The input to apply.</param>
+	void apply(SwarmSimulation& simulation, const ScriptedInput& input);
+};
+
+#endif // !HEADLESS_RUNNER_H
@@ -75,11 +75,8 @@ void HowToPlayMenu::handleEvents(sf::RenderWindow& window)
 
 bool HowToPlayMenu::loadRulesMenuBackgroundTexture()
 {
-	if (!backgroundTexture.loadFromFile("assets/main_menu_background.jpg"))
-	{
-		return false;
-	}
-	return true;
+	backgroundTexture = ResourceCache::getInstance().getTexture("assets/main_menu_background.jpg");
+	return backgroundTexture->getSize().x > 0;
 }
 
 const static float backgroundWidth = 3071;
@@ -92,7 +89,7 @@ bool HowToPlayMenu::loadRulesMenuBackgroundSprite(sf::VideoMode const videoMode)
 		return false;
 	}
 
-	backgroundSprite.setTexture(backgroundTexture);
+	backgroundSprite.setTexture(*backgroundTexture);
 	backgroundSprite.setScale((float)videoMode.width / backgroundWidth, (float)videoMode.height / backgroundHeight);
 	return true;
 }
@@ -6,6 +6,7 @@
 #include "MenuSelector.h"
 #include <SFML/Graphics.hpp>
 #include "Screen.h"
+#include "ResourceCache.h"
 
 class HowToPlayMenu : public Screen
 {
@@ -15,7 +16,7 @@ private:
 	MenuSelector* selector;
 	TextComponent* returnText;
 	sf::Sprite backgroundSprite;
-	sf::Texture backgroundTexture;
+	std::shared_ptr<const sf::Texture> backgroundTexture;
 	sf::VideoMode videoMode;
 	bool shouldGoBackToMainMenu;
 	bool loadRulesMenuBackgroundTexture();
@@ -0,0 +1,158 @@
+#include "HudCounter.h"
+
+// The most digits in an unsigned int.
+const static unsigned int maxDigits = 10;
+
+HudCounter::HudCounter(std::string textFile, std::string label, unsigned int initialValue, unsigned int size, float outlineThickness, sf::Color color)
+{
+	fontAtlas = ResourceCache::getInstance().getFontAtlas("assets/" + textFile);
+	prefix = label;
+	characterSize = size;
+	outline = outlineThickness;
+	fillColor = color;
+	value = initialValue;
+	rebuildCount = 0;
+	centerPosX = 0.0f;
+	centerPosY = 0.0f;
+	totalWidth = 0.0f;
+	prefixVertices.setPrimitiveType(sf::Quads);
+	valueVertices.setPrimitiveType(sf::Quads);
+
+	float top = 0.0f;
+	float bottom = 0.0f;
+	for (int digit = 0; digit < 10; digit++)
+	{
+		fontAtlas->getGlyph('0' + digit, characterSize, 0.0f, digitGlyphs[digit]);
+		fontAtlas->getGlyph('0' + digit, characterSize, outline, digitOutlineGlyphs[digit]);
+		top = std::min(top, digitOutlineGlyphs[digit].bounds.top);
+		bottom = std::max(bottom, digitOutlineGlyphs[digit].bounds.top + digitOutlineGlyphs[digit].bounds.height);
+	}
+
+	prefixWidth = 0.0f;
+	for (std::size_t i = 0; i < prefix.size(); i++)
+	{
+		sf::Glyph glyph;
+		fontAtlas->getGlyph((unsigned char)prefix[i], characterSize, outline, glyph);
+		if (i > 0) prefixWidth += fontAtlas->getKerning((unsigned char)prefix[i - 1], (unsigned char)prefix[i], characterSize);
+		prefixWidth += glyph.advance;
+		top = std::min(top, glyph.bounds.top);
+		bottom = std::max(bottom, glyph.bounds.top + glyph.bounds.height);
+	}
+
+	// The value is rebuilt far more often than the counter is created, so look every kerning it can need up once.
+	for (int digit = 0; digit < 10; digit++)
+	{
+		prefixDigitKerning[digit] = prefix.empty() ? 0.0f : fontAtlas->getKerning((unsigned char)prefix.back(), '0' + digit, characterSize);
+		for (int nextDigit = 0; nextDigit < 10; nextDigit++)
+		{
+			digitKerning[digit][nextDigit] = fontAtlas->getKerning('0' + digit, '0' + nextDigit, characterSize);
+		}
+	}
+
+	glyphTop = top;
+	totalHeight = bottom - top;
+	buildValue(0.0f);
+	snapToLeft();
+}
+
+HudCounter::~HudCounter()
+{
+}
+
+void HudCounter::setValue(unsigned int newValue)
+{
+	if (newValue == value) return;
+
+	float left = getLeft();
+	value = newValue;
+	buildValue(left);
+	centerPosX = left + totalWidth / 2;
+}
+
+unsigned int HudCounter::getValue() const
+{
+	return value;
+}
+
+unsigned long HudCounter::getRebuildCount() const
+{
+	return rebuildCount;
+}
+
+const sf::VertexArray& HudCounter::getValueVertices() const
+{
+	return valueVertices;
+}
+
+void HudCounter::drawTo(sf::RenderWindow& window)
+{
+	sf::RenderStates states(&fontAtlas->getTexture());
+	window.draw(prefixVertices, states);
+	window.draw(valueVertices, states);
+}
+
+float HudCounter::getLeft() const
+{
+	return centerPosX - totalWidth / 2;
+}
+
+float HudCounter::getBaseline() const
+{
+	return centerPosY - totalHeight / 2 - glyphTop;
+}
+
+void HudCounter::buildPrefix(float left)
+{
+	prefixVertices.clear();
+	for (int pass = 0; pass < 2; pass++)
+	{
+		float thickness = pass == 0 ? outline : 0.0f;
+		sf::Color color = pass == 0 ? sf::Color::Black : fillColor;
+		float penX = left;
+		for (std::size_t i = 0; i < prefix.size(); i++)
+		{
+			if (i > 0) penX += fontAtlas->getKerning((unsigned char)prefix[i - 1], (unsigned char)prefix[i], characterSize);
+			sf::Glyph glyph;
+			fontAtlas->getGlyph((unsigned char)prefix[i], characterSize, thickness, glyph);
+			FontAtlas::addGlyphQuad(prefixVertices, sf::Vector2f(penX, getBaseline()), glyph, color, thickness);
+			penX += glyph.advance;
+		}
+	}
+}
+
+void HudCounter::buildValue(float left)
+{
+	unsigned char digits[maxDigits];
+	unsigned int digitCount = 0;
+	unsigned int remaining = value;
+	do
+	{
+		digits[maxDigits - 1 - digitCount] = (unsigned char)(remaining % 10);
+		remaining /= 10;
+		digitCount++;
+	} while (remaining > 0);
+
+	valueVertices.clear();
+	float penX = left + prefixWidth;
+	for (int pass = 0; pass < 2; pass++)
+	{
+		penX = left + prefixWidth;
+		for (unsigned int i = maxDigits - digitCount; i < maxDigits; i++)
+		{
+			penX += i == maxDigits - digitCount ? prefixDigitKerning[digits[i]] : digitKerning[digits[i - 1]][digits[i]];
+			const sf::Glyph& glyph = pass == 0 ? digitOutlineGlyphs[digits[i]] : digitGlyphs[digits[i]];
+			FontAtlas::addGlyphQuad(valueVertices, sf::Vector2f(penX, getBaseline()), glyph, pass == 0 ? sf::Color::Black : fillColor, pass == 0 ? outline : 0.0f);
+			penX += glyph.advance;
+		}
+	}
+
+	totalWidth = penX - left;
+	rebuildCount++;
+}
+
+void HudCounter::updatePosition()
+{
+	float left = getLeft();
+	buildPrefix(left);
+	buildValue(left);
+}
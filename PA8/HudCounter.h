@@ -0,0 +1,166 @@
+#ifndef HUD_COUNTER_H
+#define HUD_COUNTER_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include "MoveableComponent.h"
+#include "ResourceCache.h"
+
+/// <summary>
+/// A fixed label followed by a number, such as "Score: 120", drawn as outlined text. The glyphs of the label and of the ten digits are
+/// looked up once, and the quads of the number are only rebuilt when it changes, so drawing an unchanged counter does no string or glyph
+/// work. The left edge stays in place when the number gets wider or narrower.
+/// </summary>
+class HudCounter : public MoveableComponent
+{
+public:
+	/// <summary>
+	/// Loads the font atlas and the glyphs and builds the quads of the label and the initial value.
+	/// </summary>
+	/// <param name="textFile">The name of the font file in the assets folder.</param>
+	/// <param name="label">The text drawn before the number.</param>
+	/// <param name="initialValue">The number to draw first.</param>
+	/// <param name="size">The character size.</param>
+	/// <param name="outlineThickness">The thickness of the black outline around each character.</param>
+	/// <param name="color">The fill color of each character.</param>
+	HudCounter(std::string textFile, std::string label, unsigned int initialValue, unsigned int size, float outlineThickness, sf::Color color);
+
+	~HudCounter();
+
+	/// <summary>
+	/// Changes the number drawn after the label. Does nothing if the number is unchanged.
+	/// </summary>
+	/// <param name="newValue">The number to draw.</param>
+	void setValue(unsigned int newValue);
+
+	/// <summary>
+	/// Gets the number drawn after the label.
+	/// </summary>
+	/// <returns>The number drawn after the label.</returns>
+	unsigned int getValue() const;
+
+	/// <summary>
+	/// Gets how many times the quads of the number have been built, including the first time.
+	/// </summary>
+	/// <returns>The number of times the quads of the number have been built.</returns>
+	unsigned long getRebuildCount() const;
+
+	/// <summary>
+	/// Gets the quads of the number: the outline quads of every digit followed by their fill quads.
+	/// </summary>
+	/// <returns>The quads of the number.</returns>
+	const sf::VertexArray& getValueVertices() const;
+
+	/// <summary>
+	/// Draws the label and the number to the window.
+	/// </summary>
+	/// <param name="window">The window to draw to.</param>
+	void drawTo(sf::RenderWindow& window);
+
+private:
+	/// <summary>
+	/// The font atlas holding the glyphs.
+	/// </summary>
+	std::shared_ptr<const FontAtlas> fontAtlas;
+
+	/// <summary>
+	/// The text drawn before the number.
+	/// </summary>
+	std::string prefix;
+
+	/// <summary>
+	/// The character size.
+	/// </summary>
+	unsigned int characterSize;
+
+	/// <summary>
+	/// The thickness of the outline around each character.
+	/// </summary>
+	float outline;
+
+	/// <summary>
+	/// The fill color of each character.
+	/// </summary>
+	sf::Color fillColor;
+
+	/// <summary>
+	/// The number drawn after the label.
+	/// </summary>
+	unsigned int value;
+
+	/// <summary>
+	/// The fill glyph of each digit, indexed by the digit.
+	/// </summary>
+	sf::Glyph digitGlyphs[10];
+
+	/// <summary>
+	/// The outline glyph of each digit, indexed by the digit.
+	/// </summary>
+	sf::Glyph digitOutlineGlyphs[10];
+
+	/// <summary>
+	/// The kerning between the last character of the label and each digit, indexed by the digit. 0 when there is no label.
+	/// </summary>
+	float prefixDigitKerning[10];
+
+	/// <summary>
+	/// The kerning between each pair of digits, indexed by the first digit and then the second.
+	/// </summary>
+	float digitKerning[10][10];
+
+	/// <summary>
+	/// The distance from the baseline to the top of the tallest glyph. Negative, since the top is above the baseline.
+	/// </summary>
+	float glyphTop;
+
+	/// <summary>
+	/// The width of the label, where the number starts.
+	/// </summary>
+	float prefixWidth;
+
+	/// <summary>
+	/// The quads of the label. Only rebuilt when the counter moves.
+	/// </summary>
+	sf::VertexArray prefixVertices;
+
+	/// <summary>
+	/// The quads of the number. Rebuilt when the number changes or the counter moves.
+	/// </summary>
+	sf::VertexArray valueVertices;
+
+	/// <summary>
+	/// The number of times the quads of the number have been built.
+	/// </summary>
+	unsigned long rebuildCount;
+
+	/// <summary>
+	/// Gets the x-axis coordinate of the left edge of the counter.
+	/// </summary>
+	/// <returns>The x-axis coordinate of the left edge.</returns>
+	float getLeft() const;
+
+	/// <summary>
+	/// Gets the y-axis coordinate of the baseline of the text.
+	/// </summary>
+	/// <returns>The y-axis coordinate of the baseline.</returns>
+	float getBaseline() const;
+
+	/// <summary>
+	/// Rebuilds the quads of the label starting at the provided left edge.
+	/// </summary>
+	/// <param name="left">The x-axis coordinate of the left edge of the counter.</param>
+	void buildPrefix(float left);
+
+	/// <summary>
+	/// Rebuilds the quads of the number after the label and updates the width of the counter.
+	/// </summary>
+	/// <param name="left">The x-axis coordinate of the left edge of the counter.</param>
+	void buildValue(float left);
+
+	/// <summary>
+	/// Rebuilds every quad at the new position.
+	/// </summary>
+	void updatePosition();
+};
+
+#endif // !HUD_COUNTER_H
@@ -1,20 +1,27 @@
 #include "LoadingModal.h"
 #include <iostream>
+#include <algorithm>
 
 LoadingModal::LoadingModal(sf::VideoMode vm) : Modal(ModalSize::Small, vm)
 {
 	videoMode = vm;
-	if (!iconTexture.loadFromFile("assets/gear_icon.png"))
-	{
-		std::cout << "Failed to load gear_icon texture;" << std::endl;
-	}
 
 	float iconSize = 0.1f * videoMode.width;
 	
-	gearIcon.setTexture(&iconTexture);
+	guiAtlas->applyTo(gearIcon, "gear_icon");
 	gearIcon.setSize(sf::Vector2f(iconSize, iconSize));
 	gearIcon.setOrigin(iconSize / 2, iconSize / 2);
 	gearIcon.setPosition((float)videoMode.width / 2, (float)videoMode.height / 2);
+
+	float barWidth = 0.1f * videoMode.width;
+	float barHeight = 0.01f * videoMode.height;
+	progressTrack.setSize(sf::Vector2f(barWidth, barHeight));
+	progressTrack.setPosition(((float)videoMode.width - barWidth) / 2, (float)videoMode.height / 2 + iconSize * 0.75f);
+	progressTrack.setFillColor(sf::Color(40, 40, 40));
+	progressFill.setSize(sf::Vector2f(0, barHeight));
+	progressFill.setPosition(progressTrack.getPosition());
+	progressFill.setFillColor(sf::Color::Green);
+	isProgressShown = false;
 }
 
 LoadingModal::~LoadingModal()
@@ -25,6 +32,11 @@ void LoadingModal::drawTo(sf::RenderWindow& window)
 {
 	Modal::drawTo(window);
 	window.draw(gearIcon);
+
+	if (!isProgressShown) return;
+
+	window.draw(progressTrack);
+	window.draw(progressFill);
 }
 
 void LoadingModal::updateState()
@@ -33,3 +45,10 @@ void LoadingModal::updateState()
 	gearIcon.rotate(timeElapsed * degreesPerMillisecond);
 	if (timeElapsed > 0) rotationClock.restart();
 }
+
+void LoadingModal::setProgress(float progress)
+{
+	progress = std::min(std::max(progress, 0.0f), 1.0f);
+	progressFill.setSize(sf::Vector2f(progressTrack.getSize().x * progress, progressTrack.getSize().y));
+	isProgressShown = true;
+}
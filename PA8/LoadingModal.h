@@ -4,7 +4,7 @@
 #include "Modal.h"
 
 /// <summary>
-/// This modal displays a spinning gear to indicate loading.
+/// This modal displays a spinning gear to indicate loading, and a progress bar once the progress is known.
 /// </summary>
 class LoadingModal : public Modal
 {
@@ -29,6 +29,12 @@ public:
 	/// </summary>
 	void updateState();
 
+	/// <summary>
+	/// Shows the progress bar filled to the provided portion.
+	/// </summary>
+	/// <param name="progress">A value from 0 to 1.</param>
+	void setProgress(float progress);
+
 private:
 	/// <summary>
 	/// The video mode will render this modal.
@@ -36,14 +42,24 @@ private:
 	sf::VideoMode videoMode;
 
 	/// <summary>
-	/// The texture that contains the gear icon.
+	/// The rectangle that will contain the rotating gear texture.
 	/// </summary>
-	sf::Texture iconTexture;
+	sf::RectangleShape gearIcon;
 
 	/// <summary>
-	/// The rectangle that will contain the rotating gear texture.
+	/// The empty bar behind the progress bar.
 	/// </summary>
-	sf::RectangleShape gearIcon;
+	sf::RectangleShape progressTrack;
+
+	/// <summary>
+	/// The bar that fills the track as progress is made.
+	/// </summary>
+	sf::RectangleShape progressFill;
+
+	/// <summary>
+	/// Is true once the progress has been set. The progress bar is hidden until then.
+	/// </summary>
+	bool isProgressShown;
 
 	/// <summary>
 	/// A clock to ensure the rotation is time based instead of processor speed based.
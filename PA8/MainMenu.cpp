@@ -250,11 +250,8 @@ const static float backgroundHeight = 2299;
 
 bool MainMenu::loadMainMenuBackgroundTexture()
 {
-	if (!backgroundTexture.loadFromFile("assets/main_menu_background.jpg"))
-	{
-		return false;
-	}
-	return true;
+	backgroundTexture = ResourceCache::getInstance().getTexture("assets/main_menu_background.jpg");
+	return backgroundTexture->getSize().x > 0;
 }
 
 bool MainMenu::loadMainMenuBackgroundSprite(sf::VideoMode const videoMode)
@@ -264,7 +261,7 @@ bool MainMenu::loadMainMenuBackgroundSprite(sf::VideoMode const videoMode)
 		return false;
 	}
 
-	backgroundSprite.setTexture(backgroundTexture);
+	backgroundSprite.setTexture(*backgroundTexture);
 	backgroundSprite.setScale((float)videoMode.width / backgroundWidth, (float)videoMode.height / backgroundHeight);
 	return true;
 }
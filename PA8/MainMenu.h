@@ -6,6 +6,7 @@
 #include <SFML/Graphics.hpp>
 #include "Screen.h"
 #include "Screens.h"
+#include "ResourceCache.h"
 #include "MainMenuSelection.h"
 #include "IpAddressInputModal.h"
 #include "TcpServer.h"
@@ -123,9 +124,9 @@ private:
 	sf::Sprite backgroundSprite;
 
 	/// <summary>
-	/// The texture containing the background image.
+	/// The texture containing the background image, shared with the how to play menu.
 	/// </summary>
-	sf::Texture backgroundTexture;
+	std::shared_ptr<const sf::Texture> backgroundTexture;
 
 	/// <summary>
 	/// Loads the background texture for this screen.
@@ -5,15 +5,15 @@
 MenuSelector::MenuSelector(float width, float height)
 {
     sf::Vector2f borderSquareSize(cornerSingleBorderSquareLength, cornerSingleBorderSquareLength);
-    topLeftBorder.setTexture(&topLeftSingleBorder);
+    guiAtlas->applyTo(topLeftBorder, "top_left_single_border");
     topLeftBorder.setSize(borderSquareSize);
-    bottomLeftBorder.setTexture(&bottomLeftSingleBorder);
+    guiAtlas->applyTo(bottomLeftBorder, "bottom_left_single_border");
     bottomLeftBorder.setOrigin(0, -cornerSingleBorderSquareLength);
     bottomLeftBorder.setSize(borderSquareSize);
-    topRightBorder.setTexture(&topRightSingleBorder);
+    guiAtlas->applyTo(topRightBorder, "top_right_single_border");
     topRightBorder.setOrigin(-cornerSingleBorderSquareLength, 0);
     topRightBorder.setSize(borderSquareSize);
-    bottomRightBorder.setTexture(&bottomRightSingleBorder);
+    guiAtlas->applyTo(bottomRightBorder, "bottom_right_single_border");
     bottomRightBorder.setOrigin(-cornerSingleBorderSquareLength, -cornerSingleBorderSquareLength);
     bottomRightBorder.setSize(borderSquareSize);
     
@@ -39,7 +39,7 @@ bool Modal::loadModalBackground()
 {
 	float modalWidth = getWidthByModalSize() - 17;
 	float modalHeight = getHeightByModalSize() - 17;
-	background.setTexture(&modalBackground);
+	background.setTexture(modalBackground.get());
 	background.setSize(sf::Vector2f(modalWidth, modalHeight));
 	background.setOrigin(modalWidth/2, modalHeight/2);
 	return true;
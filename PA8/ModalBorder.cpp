@@ -6,41 +6,41 @@ ModalBorder::ModalBorder(float width, float height)
     height = height < (cornerDoubleBorderSquareLength * 2 + verticalDoubleBorderLength) ? cornerDoubleBorderSquareLength * 2 + verticalDoubleBorderLength : height;
     width = width < (cornerDoubleBorderSquareLength * 2 + horizontalDoubleBorderLength) ? cornerDoubleBorderSquareLength * 2 + horizontalDoubleBorderLength : width;
 
-    topLeftBorder.setTexture(&topLeftDoubleBorder);
+    guiAtlas->applyTo(topLeftBorder, "top_left_double_border");
     topLeftBorder.setSize(sf::Vector2f(cornerDoubleBorderSquareLength, cornerDoubleBorderSquareLength));
 
-    bottomLeftBorder.setTexture(&bottomLeftDoubleBorder);
+    guiAtlas->applyTo(bottomLeftBorder, "bottom_left_double_border");
     bottomLeftBorder.setOrigin(0, cornerDoubleBorderSquareLength);
     bottomLeftBorder.setSize(sf::Vector2f(cornerDoubleBorderSquareLength, cornerDoubleBorderSquareLength));
 
-    topRightBorder.setTexture(&topRightDoubleBorder);
+    guiAtlas->applyTo(topRightBorder, "top_right_double_border");
     topRightBorder.setOrigin(cornerDoubleBorderSquareLength, 0);
     topRightBorder.setSize(sf::Vector2f(cornerDoubleBorderSquareLength, cornerDoubleBorderSquareLength));
     
-    bottomRightBorder.setTexture(&bottomRightDoubleBorder);
+    guiAtlas->applyTo(bottomRightBorder, "bottom_right_double_border");
     bottomRightBorder.setOrigin(cornerDoubleBorderSquareLength, cornerDoubleBorderSquareLength);
     bottomRightBorder.setSize(sf::Vector2f(cornerDoubleBorderSquareLength, cornerDoubleBorderSquareLength));
 
     auto borderWidth = (int)width - 2 * cornerDoubleBorderSquareLength;
 
-    topBorder.setTexture(&topDoubleBorder);
+    topBorder.setTexture(topDoubleBorder.get());
     topBorder.setTextureRect(sf::IntRect(0, 0, borderWidth, longDoubleBorderThickness));
     topBorder.setOrigin((width - 2 * cornerDoubleBorderSquareLength) / (float)2, 0);
     topBorder.setSize(sf::Vector2f(width-2* cornerDoubleBorderSquareLength, longDoubleBorderThickness));
 
-    bottomBorder.setTexture(&bottomDoubleBorder);
+    bottomBorder.setTexture(bottomDoubleBorder.get());
     bottomBorder.setTextureRect(sf::IntRect(0, 0, borderWidth, longDoubleBorderThickness));
     bottomBorder.setOrigin((width - 2 * cornerDoubleBorderSquareLength) / (float)2, longDoubleBorderThickness);
     bottomBorder.setSize(sf::Vector2f(width - 2 * cornerDoubleBorderSquareLength, longDoubleBorderThickness));
 
     auto borderHeight = (int)height - 2 * cornerDoubleBorderSquareLength;
 
-    leftBorder.setTexture(&leftDoubleBorder);
+    leftBorder.setTexture(leftDoubleBorder.get());
     leftBorder.setTextureRect(sf::IntRect(0, 0, longDoubleBorderThickness, borderHeight));
     leftBorder.setOrigin(0, (height - 2 * cornerDoubleBorderSquareLength) / (float)2);
     leftBorder.setSize(sf::Vector2f(longDoubleBorderThickness, height - 2 * cornerDoubleBorderSquareLength));
 
-    rightBorder.setTexture(&rightDoubleBorder);
+    rightBorder.setTexture(rightDoubleBorder.get());
     rightBorder.setTextureRect(sf::IntRect(0, 0, longDoubleBorderThickness, borderHeight));
     rightBorder.setOrigin(longDoubleBorderThickness, (height - 2 * cornerDoubleBorderSquareLength) / (float)2);
     rightBorder.setSize(sf::Vector2f(longDoubleBorderThickness, height - 2 * cornerDoubleBorderSquareLength));
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <cmath>
+#include "AABB.h"
 
 /// <summary>
 /// This is a base class to be inherited by any component that can be moved. It contains convenience functions for moving the component to various
@@ -317,6 +318,15 @@ public:
 		return sf::Vector2f(centerPosX, centerPosY);
 	}
 
+	/// <summary>
+	/// Gets the axis-aligned bounding box of this component.
+	/// </summary>
+	/// <returns>The bounding box of this component.</returns>
+	AABB getBounds() const
+	{
+		return AABB::fromCenter(sf::Vector2f(centerPosX, centerPosY), sf::Vector2f(totalWidth, totalHeight));
+	}
+
 	/// <summary>
 	/// Draws this components to the provided window.
 	/// </summary>
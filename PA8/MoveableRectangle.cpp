@@ -38,9 +38,9 @@ void MoveableRectangle::drawTo(sf::RenderWindow& window)
 	window.draw(shape);
 }
 
-bool MoveableRectangle::didCollideWithOtherComponent(MoveableRectangle otherComponent)
+bool MoveableRectangle::didCollideWithOtherComponent(const MoveableRectangle& otherComponent) const
 {
-	return didComponentsCollide(*this, otherComponent);
+	return getBounds().overlaps(otherComponent.getBounds());
 }
 
 void MoveableRectangle::setTexture(const sf::Texture* newTexture)
@@ -48,6 +48,12 @@ void MoveableRectangle::setTexture(const sf::Texture* newTexture)
 	shape.setTexture(newTexture);
 }
 
+void MoveableRectangle::setTexture(const sf::Texture* newTexture, const sf::IntRect& textureRect)
+{
+	shape.setTexture(newTexture);
+	shape.setTextureRect(textureRect);
+}
+
 void MoveableRectangle::mirror()
 {
 	shape.setScale(-1.0f, 1.0f);
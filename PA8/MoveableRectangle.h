@@ -42,7 +42,7 @@ public:
 	/// </summary>
 	/// <param name="otherComponent">The component to check if this component has collided with.</param>
 	/// <returns>True if this component collided with the provided component.</returns>
-	bool didCollideWithOtherComponent(MoveableRectangle otherComponent);
+	bool didCollideWithOtherComponent(const MoveableRectangle& otherComponent) const;
 
 	/// <summary>
 	/// Sets the texture of this component. Used mostly for animation.
@@ -50,6 +50,13 @@ public:
 	/// <param name="newTexture">The new texture this component will render.</param>
 	void setTexture(const sf::Texture* newTexture);
 
+	/// <summary>
+	/// Sets the texture of this component to part of the provided texture, such as an image in a texture atlas.
+	/// </summary>
+	/// <param name="newTexture">The new texture this component will render.</param>
+	/// <param name="textureRect">The part of the texture to render.</param>
+	void setTexture(const sf::Texture* newTexture, const sf::IntRect& textureRect);
+
 	/// <summary>
 	/// Mirrors this component along the y-axis. Used when texture is not symmetrical along the y-axis.
 	/// </summary>
@@ -80,39 +87,6 @@ private:
 	/// Updates the position of this component so it is correctly positioned relative to the center.
 	/// </summary>
 	void updatePosition();
-
-	/// <summary>
-	/// Returns true if the two components collided.
-	/// </summary>
-	/// <param name="componentA">The first component in the potential collision.</param>
-	/// <param name="componentB">The other component in the potential collision.</param>
-	/// <returns>True if the two components collided.</returns>
-	static bool didComponentsCollide(MoveableRectangle componentA, MoveableRectangle componentB)
-	{
-		return doOverlapOnX(componentA, componentB) && doOverlapOnY(componentA, componentB);
-	}
-
-	/// <summary>
-	/// Returns true if the two components overlap on the x-axis.
-	/// </summary>
-	/// <param name="componentA">The first component in the potential collision.</param>
-	/// <param name="componentB">The other component in the potential collision.</param>
-	/// <returns></returns>
-	static bool doOverlapOnX(MoveableRectangle componentA, MoveableRectangle componentB)
-	{
-		return componentA.getRightPosXToCenter() >= componentB.getLeftPosXToCenter() && componentA.getLeftPosXToCenter() <= componentB.getRightPosXToCenter();
-	}
-
-	/// <summary>
-	/// Returns true if the two components overlap on the y-axis.
-	/// </summary>
-	/// <param name="componentA">The first component in the potential collision.</param>
-	/// <param name="componentB">The other component in the potential collision.</param>
-	/// <returns></returns>
-	static bool doOverlapOnY(MoveableRectangle componentA, MoveableRectangle componentB)
-	{
-		return componentA.getBottomPosYToCenter() >= componentB.getTopPosYToCenter() && componentA.getTopPosYToCenter() <= componentB.getBottomPosYToCenter();
-	}
 };
 
 #endif // !MOVEABLE_RECTANGLE_H
@@ -0,0 +1,139 @@
+#include "MovementKernel.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MOVEMENT_KERNEL_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(MOVEMENT_KERNEL_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MOVEMENT_KERNEL_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define MOVEMENT_KERNEL_AVX2_TARGET
+#endif
+
+void MovementKernel::advanceTowards(
+	float* positionX,
+	float* positionY,
+	const unsigned char* flags,
+	unsigned char skipFlags,
+	std::size_t count,
+	float targetX,
+	float targetY,
+	float distanceToShift
+	)
+{
+	static const bool useAvx2 = isAvx2Supported();
+	if (useAvx2)
+	{
+		advanceTowardsAvx2(positionX, positionY, flags, skipFlags, count, targetX, targetY, distanceToShift);
+		return;
+	}
+
+	advanceTowardsScalar(positionX, positionY, flags, skipFlags, count, targetX, targetY, distanceToShift);
+}
+
+bool MovementKernel::isAvx2Supported()
+{
+#if defined(MOVEMENT_KERNEL_X86) && defined(_MSC_VER)
+	int registers[4];
+	__cpuid(registers, 0);
+	if (registers[0] < 7) return false;
+
+	__cpuid(registers, 1);
+	bool osSavesYmm = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+	if (!osSavesYmm) return false;
+
+	__cpuidex(registers, 7, 0);
+	return (registers[1] & (1 << 5)) != 0;
+#elif defined(MOVEMENT_KERNEL_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+void MovementKernel::advanceTowardsScalar(
+	float* positionX,
+	float* positionY,
+	const unsigned char* flags,
+	unsigned char skipFlags,
+	std::size_t count,
+	float targetX,
+	float targetY,
+	float distanceToShift
+	)
+{
+	for (std::size_t i = 0; i < count; i++)
+	{
+		if ((flags[i] & skipFlags) != 0) continue;
+
+		float diffX = positionX[i] - targetX;
+		float diffY = positionY[i] - targetY;
+		float distance = std::sqrt(diffX * diffX + diffY * diffY);
+		float remaining = distance - distanceToShift;
+		if (remaining <= 0)
+		{
+			positionX[i] = targetX;
+			positionY[i] = targetY;
+			continue;
+		}
+
+		float scale = remaining / distance;
+		positionX[i] = targetX + diffX * scale;
+		positionY[i] = targetY + diffY * scale;
+	}
+}
+
+MOVEMENT_KERNEL_AVX2_TARGET
+void MovementKernel::advanceTowardsAvx2(
+	float* positionX,
+	float* positionY,
+	const unsigned char* flags,
+	unsigned char skipFlags,
+	std::size_t count,
+	float targetX,
+	float targetY,
+	float distanceToShift
+	)
+{
+	std::size_t i = 0;
+#ifdef MOVEMENT_KERNEL_X86
+	const __m256 target8X = _mm256_set1_ps(targetX);
+	const __m256 target8Y = _mm256_set1_ps(targetY);
+	const __m256 shift8 = _mm256_set1_ps(distanceToShift);
+	const __m256 zero8 = _mm256_setzero_ps();
+	const __m256i skip8 = _mm256_set1_epi32(skipFlags);
+	const __m256i zero8i = _mm256_setzero_si256();
+
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256i flags8 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(flags + i)));
+		__m256 isMoving = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(flags8, skip8), zero8i));
+		if (_mm256_movemask_ps(isMoving) == 0) continue;
+
+		__m256 oldX = _mm256_loadu_ps(positionX + i);
+		__m256 oldY = _mm256_loadu_ps(positionY + i);
+		__m256 diffX = _mm256_sub_ps(oldX, target8X);
+		__m256 diffY = _mm256_sub_ps(oldY, target8Y);
+		__m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(diffX, diffX), _mm256_mul_ps(diffY, diffY)));
+		__m256 remaining = _mm256_sub_ps(distance, shift8);
+		__m256 isShort = _mm256_cmp_ps(remaining, zero8, _CMP_LE_OQ);
+
+		// Positions that reach the target get a scale of zero, which also avoids dividing by a zero distance.
+		__m256 scale = _mm256_div_ps(remaining, _mm256_blendv_ps(distance, _mm256_set1_ps(1.0f), isShort));
+		scale = _mm256_blendv_ps(scale, zero8, isShort);
+
+		__m256 newX = _mm256_add_ps(target8X, _mm256_mul_ps(diffX, scale));
+		__m256 newY = _mm256_add_ps(target8Y, _mm256_mul_ps(diffY, scale));
+		_mm256_storeu_ps(positionX + i, _mm256_blendv_ps(oldX, newX, isMoving));
+		_mm256_storeu_ps(positionY + i, _mm256_blendv_ps(oldY, newY, isMoving));
+	}
+#endif
+
+	advanceTowardsScalar(positionX + i, positionY + i, flags + i, skipFlags, count - i, targetX, targetY, distanceToShift);
+}
@@ -0,0 +1,73 @@
+#ifndef MOVEMENT_KERNEL_H
+#define MOVEMENT_KERNEL_H
+
+#include <cstddef>
+
+/// <summary>
+/// Batched movement over contiguous position arrays. Replaces calling MoveableComponent::shiftTowards once per component: instead of
+/// atan, sin and cos, each position is moved along its normalised direction vector to the target. Uses AVX2 when the processor supports
+/// it and a scalar loop otherwise. Both paths agree to within rounding.
+/// </summary>
+class MovementKernel
+{
+public:
+	/// <summary>
+	/// Shifts every position whose flags share no bits with skipFlags towards the provided target by the provided number of pixels.
+	/// Positions closer to the target than that distance are moved onto the target.
+	/// </summary>
+	/// <param name="positionX">The x-axis coordinates to update.</param>
+	/// <param name="positionY">The y-axis coordinates to update.</param>
+	/// <param name="flags">The flags of each position.</param>
+	/// <param name="skipFlags">The flags that prevent a position from moving.</param>
+	/// <param name="count">The number of positions.</param>
+	/// <param name="targetX">The x-axis coordinate of the target.</param>
+	/// <param name="targetY">The y-axis coordinate of the target.</param>
+	/// <param name="distanceToShift">The number of pixels to shift.</param>
+	static void advanceTowards(
+		float* positionX,
+		float* positionY,
+		const unsigned char* flags,
+		unsigned char skipFlags,
+		std::size_t count,
+		float targetX,
+		float targetY,
+		float distanceToShift
+		);
+
+	/// <summary>
+	/// Returns true if advanceTowards will use the AVX2 path on this processor.
+	/// </summary>
+	/// <returns>True if the AVX2 path is used.</returns>
+	static bool isAvx2Supported();
+
+	/// <summary>
+	/// The scalar implementation of advanceTowards. Public so the two paths can be compared.
+	/// </summary>
+	static void advanceTowardsScalar(
+		float* positionX,
+		float* positionY,
+		const unsigned char* flags,
+		unsigned char skipFlags,
+		std::size_t count,
+		float targetX,
+		float targetY,
+		float distanceToShift
+		);
+
+private:
+	/// <summary>
+	/// The AVX2 implementation of advanceTowards. Only called when isAvx2Supported returns true.
+	/// </summary>
+	static void advanceTowardsAvx2(
+		float* positionX,
+		float* positionY,
+		const unsigned char* flags,
+		unsigned char skipFlags,
+		std::size_t count,
+		float targetX,
+		float targetY,
+		float distanceToShift
+		);
+};
+
+#endif // !MOVEMENT_KERNEL_H
@@ -0,0 +1,196 @@
+#include "Profiler.h"
+
+const static std::size_t samplesKeptPerSection = 4096;
+
+sf::Clock ProfileScope::clock;
+
+Profiler& Profiler::getInstance()
+{
+	static Profiler instance;
+	return instance;
+}
+
+Profiler::Profiler()
+{
+	isEnabled = false;
+}
+
+unsigned int Profiler::registerSection(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (std::size_t i = 0; i < sections.size(); i++)
+	{
+		if (sections[i].name == name) return (unsigned int)i;
+	}
+
+	Section section;
+	section.name = name;
+	section.nextSample = 0;
+	section.count = 0;
+	section.totalMicroseconds = 0;
+	section.maxMicroseconds = 0;
+	sections.push_back(section);
+	return (unsigned int)(sections.size() - 1);
+}
+
+void Profiler::record(unsigned int section, sf::Int64 microseconds)
+{
+	if (!isEnabled) return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (section >= sections.size()) return;
+
+	Section& timed = sections[section];
+	if (timed.samples.size() < samplesKeptPerSection)
+	{
+		timed.samples.push_back(microseconds);
+	}
+	else {
+		timed.samples[timed.nextSample] = microseconds;
+		timed.nextSample = (timed.nextSample + 1) % samplesKeptPerSection;
+	}
+
+	timed.count++;
+	timed.totalMicroseconds += microseconds;
+	timed.maxMicroseconds = std::max(timed.maxMicroseconds, microseconds);
+}
+
+unsigned int Profiler::registerCounter(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (std::size_t i = 0; i < counters.size(); i++)
+	{
+		if (counters[i].name == name) return (unsigned int)i;
+	}
+
+	ProfileCounter counter;
+	counter.name = name;
+	counter.value = 0;
+	counters.push_back(counter);
+	isCounterSet.push_back(false);
+	return (unsigned int)(counters.size() - 1);
+}
+
+void Profiler::setCounter(unsigned int counter, long long value)
+{
+	if (!isEnabled) return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (counter >= counters.size()) return;
+
+	counters[counter].value = value;
+	isCounterSet[counter] = true;
+}
+
+std::vector<ProfileCounter> Profiler::getCounters()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<ProfileCounter> setCounters;
+	for (std::size_t i = 0; i < counters.size(); i++)
+	{
+		if (isCounterSet[i]) setCounters.push_back(counters[i]);
+	}
+
+	return setCounters;
+}
+
+void Profiler::setIsEnabled(bool enabled)
+{
+	isEnabled = enabled;
+}
+
+bool Profiler::getIsEnabled() const
+{
+	return isEnabled;
+}
+
+std::vector<ProfileSummary> Profiler::summarize(std::size_t recentSamples)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::vector<ProfileSummary> summaries;
+	std::vector<sf::Int64> window;
+	for (std::size_t i = 0; i < sections.size(); i++)
+	{
+		const Section& section = sections[i];
+		if (section.count == 0) continue;
+
+		std::size_t kept = section.samples.size();
+		std::size_t windowSize = recentSamples == 0 ? kept : std::min(recentSamples, kept);
+		window.clear();
+		for (std::size_t j = 0; j < windowSize; j++)
+		{
+			window.push_back(section.samples[(section.nextSample + kept - windowSize + j) % kept]);
+		}
+
+		ProfileSummary summary;
+		summary.name = section.name;
+		summary.count = section.count;
+		summary.meanMicroseconds = (double)section.totalMicroseconds / section.count;
+		summary.p50Microseconds = getPercentile(window, 0.5f);
+		summary.p99Microseconds = getPercentile(window, 0.99f);
+		summary.maxMicroseconds = section.maxMicroseconds;
+		summaries.push_back(summary);
+	}
+
+	return summaries;
+}
+
+bool Profiler::writeCsv(const std::string& path)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::cout << "Failed to write profile " << path << "." << std::endl;
+		return false;
+	}
+
+	std::vector<ProfileSummary> summaries = summarize();
+	file << "section,count,mean_us,p50_us,p99_us,max_us" << std::endl;
+	for (std::size_t i = 0; i < summaries.size(); i++)
+	{
+		file << summaries[i].name << "," << summaries[i].count << "," << summaries[i].meanMicroseconds << ","
+			<< summaries[i].p50Microseconds << "," << summaries[i].p99Microseconds << "," << summaries[i].maxMicroseconds << std::endl;
+	}
+
+	return file.good();
+}
+
+void Profiler::reset()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (std::size_t i = 0; i < sections.size(); i++)
+	{
+		sections[i].samples.clear();
+		sections[i].nextSample = 0;
+		sections[i].count = 0;
+		sections[i].totalMicroseconds = 0;
+		sections[i].maxMicroseconds = 0;
+	}
+
+	for (std::size_t i = 0; i < counters.size(); i++)
+	{
+		counters[i].value = 0;
+		isCounterSet[i] = false;
+	}
+}
+
+sf::Int64 Profiler::getPercentile(std::vector<sf::Int64>& samples, float percentile)
+{
+	std::size_t index = std::min((std::size_t)(percentile * samples.size()), samples.size() - 1);
+	std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+	return samples[index];
+}
+
+ProfileScope::ProfileScope(unsigned int timedSection)
+{
+	section = timedSection;
+	isTiming = Profiler::getInstance().getIsEnabled();
+	startMicroseconds = isTiming ? clock.getElapsedTime().asMicroseconds() : 0;
+}
+
+ProfileScope::~ProfileScope()
+{
+	if (!isTiming) return;
+
+	Profiler::getInstance().record(section, clock.getElapsedTime().asMicroseconds() - startMicroseconds);
+}
@@ -0,0 +1,265 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SFML/System.hpp>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+/// <summary>
+/// The timing statistics of one profiled section.
+/// </summary>
+struct ProfileSummary
+{
+	/// <summary>
+	/// The name of the section.
+	/// </summary>
+	std::string name;
+
+	/// <summary>
+	/// The number of times the section was timed since the profiler was enabled.
+	/// </summary>
+	std::size_t count;
+
+	/// <summary>
+	/// The mean time of the section in microseconds since the profiler was enabled.
+	/// </summary>
+	double meanMicroseconds;
+
+	/// <summary>
+	/// The median time of the section in microseconds over the summarized samples.
+	/// </summary>
+	sf::Int64 p50Microseconds;
+
+	/// <summary>
+	/// The 99th percentile time of the section in microseconds over the summarized samples.
+	/// </summary>
+	sf::Int64 p99Microseconds;
+
+	/// <summary>
+	/// The longest time of the section in microseconds since the profiler was enabled.
+	/// </summary>
+	sf::Int64 maxMicroseconds;
+};
+
+/// <summary>
+/// The latest value of one profiled counter.
+/// </summary>
+struct ProfileCounter
+{
+	/// <summary>
+	/// The name of the counter.
+	/// </summary>
+	std::string name;
+
+	/// <summary>
+	/// The value the counter was last set to.
+	/// </summary>
+	long long value;
+};
+
+/// <summary>
+/// A process-wide record of how long named sections of the frame take. Sections are registered once by name and then timed with a
+/// ProfileScope. Each section keeps its most recent samples for percentiles along with running totals for the mean and maximum. Does
+/// nothing until enabled, so the timers can stay in the hot paths. Named counters hold the latest value of a quantity, such as the number of
+/// objects alive, next to the timings.
+/// </summary>
+class Profiler
+{
+public:
+	/// <summary>
+	/// Gets the profiler shared by the whole program.
+	/// </summary>
+	/// <returns>The shared profiler.</returns>
+	static Profiler& getInstance();
+
+	/// <summary>
+	/// Registers a section with the provided name, or finds the section already registered with it.
+	/// </summary>
+	/// <param name="name">The name of the section.</param>
+	/// <returns>The id of the section, passed to ProfileScope and record.</returns>
+	unsigned int registerSection(const std::string& name);
+
+	/// <summary>
+	/// Records one timing of the provided section. Ignored while the profiler is disabled.
+	/// </summary>
+	/// <param name="section">The id of the section.</param>
+	/// <param name="microseconds">The time the section took in microseconds.</param>
+	void record(unsigned int section, sf::Int64 microseconds);
+
+	/// <summary>
+	/// Registers a counter with the provided name, or finds the counter already registered with it.
+	/// </summary>
+	/// <param name="name">The name of the counter.</param>
+	/// <returns>The id of the counter, passed to setCounter.</returns>
+	unsigned int registerCounter(const std::string& name);
+
+	/// <summary>
+	/// Sets the value of the provided counter. Ignored while the profiler is disabled.
+	/// </summary>
+	/// <param name="counter">The id of the counter.</param>
+	/// <param name="value">The new value of the counter.</param>
+	void setCounter(unsigned int counter, long long value);
+
+	/// <summary>
+	/// Gets the latest value of every counter that has been set, in the order the counters were registered.
+	/// </summary>
+	/// <returns>The latest value of each set counter.</returns>
+	std::vector<ProfileCounter> getCounters();
+
+	/// <summary>
+	/// Enables or disables recording.
+	/// </summary>
+	/// <param name="enabled">Whether to record timings.</param>
+	void setIsEnabled(bool enabled);
+
+	/// <summary>
+	/// Returns true if timings are being recorded.
+	/// </summary>
+	/// <returns>True if timings are being recorded.</returns>
+	bool getIsEnabled() const;
+
+	/// <summary>
+	/// Gets the statistics of every section that has been timed, in the order the sections were registered.
+	/// </summary>
+	/// <param name="recentSamples">The number of most recent samples to take the percentiles over, or 0 for every kept sample.</param>
+	/// <returns>The statistics of each timed section.</returns>
+	std::vector<ProfileSummary> summarize(std::size_t recentSamples = 0);
+
+	/// <summary>
+	/// Writes the statistics of every timed section to a CSV file with the header "section,count,mean_us,p50_us,p99_us,max_us".
+	/// </summary>
+	/// <param name="path">The path of the file to write.</param>
+	/// <returns>True if the file was written.</returns>
+	bool writeCsv(const std::string& path);
+
+	/// <summary>
+	/// Discards every recorded timing and counter value. The sections and counters stay registered.
+	/// </summary>
+	void reset();
+
+private:
+	/// <summary>
+	/// The recorded timings of one section.
+	/// </summary>
+	struct Section
+	{
+		/// <summary>
+		/// The name of the section.
+		/// </summary>
+		std::string name;
+
+		/// <summary>
+		/// The most recent samples, used as a ring buffer once full.
+		/// </summary>
+		std::vector<sf::Int64> samples;
+
+		/// <summary>
+		/// The index in samples the next sample is written to once the buffer is full.
+		/// </summary>
+		std::size_t nextSample;
+
+		/// <summary>
+		/// The number of samples recorded, including those overwritten.
+		/// </summary>
+		std::size_t count;
+
+		/// <summary>
+		/// The sum of every sample recorded.
+		/// </summary>
+		sf::Int64 totalMicroseconds;
+
+		/// <summary>
+		/// The longest sample recorded.
+		/// </summary>
+		sf::Int64 maxMicroseconds;
+	};
+
+	/// <summary>
+	/// Initializes a disabled profiler with no sections. Use getInstance instead.
+	/// </summary>
+	Profiler();
+
+	Profiler(const Profiler&) = delete;
+
+	Profiler& operator=(const Profiler&) = delete;
+
+	/// <summary>
+	/// The registered sections, by id.
+	/// </summary>
+	std::vector<Section> sections;
+
+	/// <summary>
+	/// The registered counters, by id.
+	/// </summary>
+	std::vector<ProfileCounter> counters;
+
+	/// <summary>
+	/// Whether each registered counter has been set since the last reset, by id.
+	/// </summary>
+	std::vector<bool> isCounterSet;
+
+	/// <summary>
+	/// Is true while timings are being recorded. Read without the lock by every ProfileScope.
+	/// </summary>
+	std::atomic<bool> isEnabled;
+
+	/// <summary>
+	/// Guards the sections so timings can be recorded from more than one thread.
+	/// </summary>
+	std::mutex mutex;
+
+	/// <summary>
+	/// Gets the provided percentile of the provided samples, reordering them.
+	/// </summary>
+	/// <param name="samples">The samples. Must not be empty.</param>
+	/// <param name="percentile">The percentile from 0 to 1.</param>
+	/// <returns>The sample at the percentile.</returns>
+	static sf::Int64 getPercentile(std::vector<sf::Int64>& samples, float percentile);
+};
+
+/// <summary>
+/// Times the enclosing scope and records it to a section of the profiler when the scope ends. Reads no clock while the profiler is
+/// disabled.
+/// </summary>
+class ProfileScope
+{
+public:
+	/// <summary>
+	/// Starts timing the provided section.
+	/// </summary>
+	/// <param name="timedSection">The id of the section returned by Profiler::registerSection.</param>
+	ProfileScope(unsigned int timedSection);
+
+	/// <summary>
+	/// Records the time since construction to the section.
+	/// </summary>
+	~ProfileScope();
+
+private:
+	/// <summary>
+	/// The id of the section being timed.
+	/// </summary>
+	unsigned int section;
+
+	/// <summary>
+	/// Is true if the profiler was enabled when the scope started.
+	/// </summary>
+	bool isTiming;
+
+	/// <summary>
+	/// The time the scope started in microseconds, as read from the shared clock.
+	/// </summary>
+	sf::Int64 startMicroseconds;
+
+	/// <summary>
+	/// The clock shared by every scope.
+	/// </summary>
+	static sf::Clock clock;
+};
+
+#endif // !PROFILER_H
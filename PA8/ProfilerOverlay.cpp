@@ -0,0 +1,70 @@
+#include "ProfilerOverlay.h"
+
+const static unsigned int framesPerRefresh = 30;
+const static std::size_t samplesShown = 300;
+
+ProfilerOverlay::ProfilerOverlay(sf::VideoMode vm)
+{
+	videoMode = vm;
+	text = new TextComponent("Leander.ttf", "Profiler", 20, sf::Color::Yellow);
+	text->snapToTop();
+	text->snapToRight(videoMode);
+	isVisible = false;
+	wasTogglePressed = false;
+	framesSinceRefresh = framesPerRefresh;
+}
+
+ProfilerOverlay::~ProfilerOverlay()
+{
+	delete text;
+	text = nullptr;
+}
+
+void ProfilerOverlay::processKeyboardInput()
+{
+	bool isTogglePressed = sf::Keyboard::isKeyPressed(sf::Keyboard::F3);
+	if (isTogglePressed && !wasTogglePressed)
+	{
+		isVisible = !isVisible;
+		framesSinceRefresh = framesPerRefresh;
+	}
+
+	wasTogglePressed = isTogglePressed;
+}
+
+void ProfilerOverlay::updateState()
+{
+	if (!isVisible) return;
+
+	if (++framesSinceRefresh < framesPerRefresh) return;
+
+	framesSinceRefresh = 0;
+	refresh();
+}
+
+void ProfilerOverlay::drawTo(sf::RenderWindow& window)
+{
+	if (!isVisible) return;
+
+	text->drawTo(window);
+}
+
+void ProfilerOverlay::refresh()
+{
+	std::vector<ProfileSummary> summaries = Profiler::getInstance().summarize(samplesShown);
+	std::ostringstream lines;
+	lines << "section  p50 / p99 us";
+	for (std::size_t i = 0; i < summaries.size(); i++)
+	{
+		lines << std::endl << summaries[i].name << "  " << summaries[i].p50Microseconds << " / " << summaries[i].p99Microseconds;
+	}
+
+	std::vector<ProfileCounter> counters = Profiler::getInstance().getCounters();
+	for (std::size_t i = 0; i < counters.size(); i++)
+	{
+		lines << std::endl << counters[i].name << "  " << counters[i].value;
+	}
+
+	text->setText(lines.str());
+	text->snapToRight(videoMode);
+}
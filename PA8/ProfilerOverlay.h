@@ -0,0 +1,73 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <sstream>
+#include <iomanip>
+#include "TextComponent.h"
+#include "Profiler.h"
+
+/// <summary>
+/// Shows the median and 99th percentile time of every profiled section, followed by the latest value of every profiled counter, in the top
+/// right corner of the window. F3 shows or hides it.
+/// </summary>
+class ProfilerOverlay
+{
+public:
+	/// <summary>
+	/// Initializes a hidden overlay.
+	/// </summary>
+	/// <param name="vm">The video mode that renders this overlay.</param>
+	ProfilerOverlay(sf::VideoMode vm);
+
+	~ProfilerOverlay();
+
+	/// <summary>
+	/// Shows or hides the overlay when F3 is first pressed.
+	/// </summary>
+	void processKeyboardInput();
+
+	/// <summary>
+	/// Refreshes the shown statistics every few frames while the overlay is visible. Called once per frame.
+	/// </summary>
+	void updateState();
+
+	/// <summary>
+	/// Draws the overlay to the provided window if it is visible.
+	/// </summary>
+	/// <param name="window">The window to draw to.</param>
+	void drawTo(sf::RenderWindow& window);
+
+private:
+	/// <summary>
+	/// The video mode that renders this overlay.
+	/// </summary>
+	sf::VideoMode videoMode;
+
+	/// <summary>
+	/// The text showing one line per profiled section.
+	/// </summary>
+	TextComponent* text;
+
+	/// <summary>
+	/// Is true while the overlay is shown.
+	/// </summary>
+	bool isVisible;
+
+	/// <summary>
+	/// Is true while F3 is held, so holding it does not toggle the overlay every frame.
+	/// </summary>
+	bool wasTogglePressed;
+
+	/// <summary>
+	/// The number of frames since the shown statistics were refreshed.
+	/// </summary>
+	unsigned int framesSinceRefresh;
+
+	/// <summary>
+	/// Rebuilds the text from the profiler's most recent samples and counter values.
+	/// </summary>
+	void refresh();
+};
+
+#endif // !PROFILER_OVERLAY_H
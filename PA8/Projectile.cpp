@@ -1,9 +1,20 @@
 #include "Projectile.h"
 
+const static sf::Int64 projectileLifetime = 4000000;
+
 Projectile::Projectile(sf::VideoMode vm, int newId, float inpx, float inpy) : MoveableRectangle(sf::Vector2f(0.021f * vm.width, 0.013 * vm.width))
 {
 	//moveToRandomEdgescreenPos(vm);
-	
+	reset(vm, newId, inpx, inpy);
+	//refreshInterval = 500000;
+}
+
+Projectile::~Projectile()
+{
+}
+
+void Projectile::reset(sf::VideoMode vm, int newId, float inpx, float inpy)
+{
 	//Center the projectile
 	centerHorizontal(vm);
 	centerVertical(vm);
@@ -13,11 +24,8 @@ Projectile::Projectile(sf::VideoMode vm, int newId, float inpx, float inpy) : Mo
 	hasHit = false;
 	xdest = inpx;
 	ydest = inpy;
-	//refreshInterval = 500000;
-}
-
-Projectile::~Projectile()
-{
+	previousPosition = getCenterCoordinates();
+	timeToLive = projectileLifetime;
 }
 
 int Projectile::getId()
@@ -38,5 +46,32 @@ float Projectile::getxDest() {
 }
 float Projectile::getyDest() {
 	return ydest;
-};
+}
+
+void Projectile::age(sf::Int64 microseconds)
+{
+	timeToLive -= microseconds;
+}
+
+bool Projectile::getIsExpired()
+{
+	return timeToLive <= 0;
+}
 
+bool Projectile::getDidArrive()
+{
+	sf::Vector2f position = getCenterCoordinates();
+	return position.x == xdest && position.y == ydest;
+}
+
+void Projectile::storePreviousPosition()
+{
+	previousPosition = getCenterCoordinates();
+}
+
+void Projectile::writeSnapshot(ProjectileSnapshot& snapshot)
+{
+	snapshot.previousPosition = previousPosition;
+	snapshot.position = getCenterCoordinates();
+	snapshot.size = sf::Vector2f(totalWidth, totalHeight);
+}
\ No newline at end of file
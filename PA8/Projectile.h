@@ -2,6 +2,7 @@
 #define PROJECTILE_H
 
 #include "MoveableRectangle.h"
+#include "RenderSnapshot.h"
 #include <SFML/Graphics.hpp>
 #include <random>
 
@@ -21,6 +22,16 @@ public:
 
 	~Projectile();
 
+	/// <summary>
+	/// Re-centers this Projectile and points it at a new destination, so a pooled Projectile can be fired again without being
+	/// constructed again.
+	/// </summary>
+	/// <param name="vm">The video mode that will render this Projectile.</param>
+	/// <param name="newId">The unique ID of the Projectile.</param>
+	/// <param name="inpx">The x-axis coordinate of the destination.</param>
+	/// <param name="inpy">The y-axis coordinate of the destination.</param>
+	void reset(sf::VideoMode vm, int newId, float inpx, float inpy);
+
 	
 	/// Gets the unique ID of this Projectile.
 	int getId();
@@ -40,6 +51,35 @@ public:
 	float getxDest();
 	float getyDest();
 
+	/// <summary>
+	/// Shortens the remaining lifetime of this Projectile by the provided time.
+	/// </summary>
+	/// <param name="microseconds">The time in microseconds since the last call.</param>
+	void age(sf::Int64 microseconds);
+
+	/// <summary>
+	/// Returns true once this Projectile has been in flight for longer than its lifetime.
+	/// </summary>
+	/// <returns>True if the lifetime of this Projectile has run out.</returns>
+	bool getIsExpired();
+
+	/// <summary>
+	/// Returns true once this Projectile has reached its destination without hitting anything.
+	/// </summary>
+	/// <returns>True if this Projectile is at its destination.</returns>
+	bool getDidArrive();
+
+	/// <summary>
+	/// Copies the current position of this Projectile into its previous position. Called at the start of each simulation tick.
+	/// </summary>
+	void storePreviousPosition();
+
+	/// <summary>
+	/// Copies what the renderer needs to draw this Projectile into the provided snapshot.
+	/// </summary>
+	/// <param name="snapshot">The snapshot to write to.</param>
+	void writeSnapshot(ProjectileSnapshot& snapshot);
+
 	
 
 private:
@@ -51,6 +91,12 @@ private:
 	float xdest;
 	float ydest;
 
+	//The position at the start of the current tick, used to interpolate rendering
+	sf::Vector2f previousPosition;
+
+	//The time in microseconds left before the projectile is removed, even if it is still in flight
+	sf::Int64 timeToLive;
+
 };
 
 #endif 
@@ -0,0 +1,105 @@
+#include "ProjectilePool.h"
+
+// The number of projectiles each chunk of slots holds. Chunks are only allocated once every slot before them is in use.
+const static std::size_t projectilesPerChunk = 256;
+
+ProjectilePool::ProjectilePool()
+{
+	maxProjectiles = 0;
+	slotCount = 0;
+	stats = ProjectilePoolStats();
+}
+
+ProjectilePool::~ProjectilePool()
+{
+}
+
+void ProjectilePool::configure(sf::VideoMode vm, std::size_t newCapacity)
+{
+	videoMode = vm;
+	maxProjectiles = newCapacity;
+	chunks.clear();
+	slotCount = 0;
+	active.clear();
+	freeSlots.clear();
+	stats = ProjectilePoolStats();
+}
+
+Projectile* ProjectilePool::acquire(float xdest, float ydest)
+{
+	std::size_t slot;
+	if (!freeSlots.empty())
+	{
+		slot = freeSlots.back();
+		freeSlots.pop_back();
+		getSlot(slot).reset(videoMode, (int)slot, xdest, ydest);
+	}
+	else if (slotCount < maxProjectiles)
+	{
+		slot = slotCount;
+		if (slot % projectilesPerChunk == 0)
+		{
+			chunks.push_back(std::vector<Projectile>());
+			chunks.back().reserve(std::min(projectilesPerChunk, maxProjectiles - slot));
+		}
+
+		chunks.back().push_back(Projectile(videoMode, (int)slot, xdest, ydest));
+		slotCount++;
+		stats.allocations++;
+	}
+	else {
+		stats.rejections++;
+		return nullptr;
+	}
+
+	active.push_back(slot);
+	stats.acquisitions++;
+	stats.peakActive = std::max(stats.peakActive, active.size());
+	return &getSlot(slot);
+}
+
+void ProjectilePool::release(std::size_t index)
+{
+	freeSlots.push_back(active[index]);
+	active[index] = active.back();
+	active.pop_back();
+	stats.releases++;
+}
+
+void ProjectilePool::clear()
+{
+	stats.releases += active.size();
+	freeSlots.insert(freeSlots.end(), active.begin(), active.end());
+	active.clear();
+}
+
+Projectile& ProjectilePool::operator[](std::size_t index)
+{
+	return getSlot(active[index]);
+}
+
+std::size_t ProjectilePool::size() const
+{
+	return active.size();
+}
+
+bool ProjectilePool::empty() const
+{
+	return active.empty();
+}
+
+std::size_t ProjectilePool::capacity() const
+{
+	return maxProjectiles;
+}
+
+ProjectilePoolStats ProjectilePool::getStats() const
+{
+	return stats;
+}
+
+
+Projectile& ProjectilePool::getSlot(std::size_t slot)
+{
+	return chunks[slot / projectilesPerChunk][slot % projectilesPerChunk];
+}
\ No newline at end of file
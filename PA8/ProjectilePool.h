@@ -0,0 +1,158 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <algorithm>
+#include "Projectile.h"
+
+/// <summary>
+/// Counters describing how a projectile pool has been used since it was configured.
+/// </summary>
+struct ProjectilePoolStats
+{
+	/// <summary>
+	/// The number of projectiles constructed by the pool. Each construction allocates the projectile's shape, so this stops growing once
+	/// the pool has enough slots for the projectiles in flight.
+	/// </summary>
+	unsigned long allocations;
+
+	/// <summary>
+	/// The number of projectiles handed out by the pool, including recycled ones.
+	/// </summary>
+	unsigned long acquisitions;
+
+	/// <summary>
+	/// The number of projectiles returned to the pool.
+	/// </summary>
+	unsigned long releases;
+
+	/// <summary>
+	/// The number of projectiles that could not be fired because every slot was in use.
+	/// </summary>
+	unsigned long rejections;
+
+	/// <summary>
+	/// The largest number of projectiles in flight at once.
+	/// </summary>
+	std::size_t peakActive;
+};
+
+/// <summary>
+/// A pool of projectiles with a fixed capacity. Slots are allocated in chunks as the number of projectiles in flight grows, so a pool that
+/// never fills up does not reserve storage for its whole capacity, and a slot is only constructed the first time it is needed. Released slots are kept on a free list and reset when they are fired again, so sustained fire does not touch
+/// the allocator. The projectiles in flight are indexed from 0 to size() - 1; releasing one moves the last projectile into its index.
+/// </summary>
+class ProjectilePool
+{
+public:
+	/// <summary>
+	/// Initializes an empty pool with no capacity.
+	/// </summary>
+	ProjectilePool();
+
+	~ProjectilePool();
+
+	/// <summary>
+	/// Releases every projectile, frees every slot and clears the counters. Must be called before the first projectile is acquired.
+	/// </summary>
+	/// <param name="vm">The video mode that will render the projectiles.</param>
+	/// <param name="newCapacity">The largest number of projectiles in flight at once.</param>
+	void configure(sf::VideoMode vm, std::size_t newCapacity);
+
+	/// <summary>
+	/// Fires a projectile from the center of the screen at the provided coordinate, reusing a released slot if there is one.
+	/// </summary>
+	/// <param name="xdest">The x-axis coordinate of the destination.</param>
+	/// <param name="ydest">The y-axis coordinate of the destination.</param>
+	/// <returns>A pointer to the projectile, or nullptr if every slot is in use.</returns>
+	Projectile* acquire(float xdest, float ydest);
+
+	/// <summary>
+	/// Returns the projectile at the provided index to the pool. The last projectile in flight takes its index.
+	/// </summary>
+	/// <param name="index">The index of the projectile, from 0 to size() - 1.</param>
+	void release(std::size_t index);
+
+	/// <summary>
+	/// Returns every projectile in flight to the pool.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Gets the projectile at the provided index.
+	/// </summary>
+	/// <param name="index">The index of the projectile, from 0 to size() - 1.</param>
+	/// <returns>The projectile at the provided index.</returns>
+	Projectile& operator[](std::size_t index);
+
+	/// <summary>
+	/// Gets the number of projectiles in flight.
+	/// </summary>
+	/// <returns>The number of projectiles in flight.</returns>
+	std::size_t size() const;
+
+	/// <summary>
+	/// Returns true if no projectiles are in flight.
+	/// </summary>
+	/// <returns>True if no projectiles are in flight.</returns>
+	bool empty() const;
+
+	/// <summary>
+	/// Gets the largest number of projectiles the pool can hold in flight at once.
+	/// </summary>
+	/// <returns>The capacity of the pool.</returns>
+	std::size_t capacity() const;
+
+	/// <summary>
+	/// Gets the counters describing how the pool has been used.
+	/// </summary>
+	/// <returns>The counters describing how the pool has been used.</returns>
+	ProjectilePoolStats getStats() const;
+
+private:
+	/// <summary>
+	/// The video mode that will render the projectiles.
+	/// </summary>
+	sf::VideoMode videoMode;
+
+	/// <summary>
+	/// The largest number of projectiles in flight at once.
+	/// </summary>
+	std::size_t maxProjectiles;
+
+	/// <summary>
+	/// Every projectile constructed so far, in flight or not, in chunks of consecutive slots. Each chunk is reserved to its full size when it
+	/// is added, so it never reallocates and pointers into it stay valid.
+	/// </summary>
+	std::vector<std::vector<Projectile>> chunks;
+
+	/// <summary>
+	/// The number of projectiles constructed so far.
+	/// </summary>
+	std::size_t slotCount;
+
+	/// <summary>
+	/// The slot indices of the projectiles in flight.
+	/// </summary>
+	std::vector<std::size_t> active;
+
+	/// <summary>
+	/// The slot indices of the constructed projectiles that are not in flight.
+	/// </summary>
+	std::vector<std::size_t> freeSlots;
+
+	/// <summary>
+	/// The counters describing how the pool has been used.
+	/// </summary>
+	ProjectilePoolStats stats;
+
+	/// <summary>
+	/// Gets the projectile in the provided slot.
+	/// </summary>
+	/// <param name="slot">The index of the slot, from 0 to slotCount - 1.</param>
+	/// <returns>The projectile in the slot.</returns>
+	Projectile& getSlot(std::size_t slot);
+};
+
+#endif // !PROJECTILE_POOL_H
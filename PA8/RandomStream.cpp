@@ -0,0 +1,56 @@
+#include "RandomStream.h"
+
+RandomStream::RandomStream(sf::Uint64 seed, RandomSubsystem subsystem)
+{
+	state = 0;
+	increment = ((sf::Uint64)subsystem << 1) | 1u;
+	next();
+	state += seed;
+	next();
+}
+
+RandomStream::~RandomStream()
+{
+}
+
+sf::Uint64 RandomStream::makeSeed()
+{
+	std::random_device device;
+	return ((sf::Uint64)device() << 32) | device();
+}
+
+sf::Uint32 RandomStream::next()
+{
+	sf::Uint64 oldState = state;
+	state = oldState * 6364136223846793005ULL + increment;
+	sf::Uint32 shifted = (sf::Uint32)(((oldState >> 18) ^ oldState) >> 27);
+	sf::Uint32 rotation = (sf::Uint32)(oldState >> 59);
+	return (shifted >> rotation) | (shifted << ((0u - rotation) & 31));
+}
+
+float RandomStream::nextFloat()
+{
+	return (next() >> 8) * (1.0f / 16777216.0f);
+}
+
+sf::Uint32 RandomStream::nextIndex(sf::Uint32 count)
+{
+	sf::Uint64 scaled = (sf::Uint64)next() * count;
+	sf::Uint32 fraction = (sf::Uint32)scaled;
+	if (fraction < count)
+	{
+		sf::Uint32 threshold = (0u - count) % count;
+		while (fraction < threshold)
+		{
+			scaled = (sf::Uint64)next() * count;
+			fraction = (sf::Uint32)scaled;
+		}
+	}
+
+	return (sf::Uint32)(scaled >> 32);
+}
+
+bool RandomStream::nextBool()
+{
+	return (next() >> 31) != 0;
+}
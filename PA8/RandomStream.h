@@ -0,0 +1,69 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <SFML/Config.hpp>
+#include <random>
+#include "RandomSubsystem.h"
+
+/// <summary>
+/// A small, fast pseudo-random number generator (PCG32). Streams created from the same seed with different subsystems produce independent
+/// sequences, and a stream created from the same seed and subsystem always produces the same sequence, so a simulation can be replayed
+/// exactly. Not suitable for anything security related.
+/// </summary>
+class RandomStream
+{
+public:
+	/// <summary>
+	/// Initializes the stream of the provided subsystem for the provided seed.
+	/// </summary>
+	/// <param name="seed">The seed shared by every stream of a simulation.</param>
+	/// <param name="subsystem">The subsystem that draws from this stream.</param>
+	RandomStream(sf::Uint64 seed, RandomSubsystem subsystem);
+
+	~RandomStream();
+
+	/// <summary>
+	/// Gets a seed from the operating system's random device, for runs that do not need to be reproducible. Read once per simulation
+	/// rather than once per draw.
+	/// </summary>
+	/// <returns>A new seed.</returns>
+	static sf::Uint64 makeSeed();
+
+	/// <summary>
+	/// Draws the next 32 random bits.
+	/// </summary>
+	/// <returns>A uniformly distributed 32-bit number.</returns>
+	sf::Uint32 next();
+
+	/// <summary>
+	/// Draws a random float.
+	/// </summary>
+	/// <returns>A uniformly distributed float from 0 up to but not including 1.</returns>
+	float nextFloat();
+
+	/// <summary>
+	/// Draws a random index into a collection of the provided size, without the bias of taking the remainder.
+	/// </summary>
+	/// <param name="count">The size of the collection. Must not be 0.</param>
+	/// <returns>A uniformly distributed index from 0 to count - 1.</returns>
+	sf::Uint32 nextIndex(sf::Uint32 count);
+
+	/// <summary>
+	/// Draws a random boolean.
+	/// </summary>
+	/// <returns>True or false with equal probability.</returns>
+	bool nextBool();
+
+private:
+	/// <summary>
+	/// The state advanced by each draw.
+	/// </summary>
+	sf::Uint64 state;
+
+	/// <summary>
+	/// The odd increment selecting which of the generator's sequences this stream follows.
+	/// </summary>
+	sf::Uint64 increment;
+};
+
+#endif // !RANDOM_STREAM_H
@@ -0,0 +1,14 @@
+#ifndef RANDOM_SUBSYSTEM_H
+#define RANDOM_SUBSYSTEM_H
+
+/// <summary>
+/// Enum representing the parts of the simulation that draw random numbers. Each gets its own random stream, so adding draws to one part
+/// does not change the numbers another part sees for the same seed.
+/// </summary>
+enum class RandomSubsystem
+{
+	Spawning,
+	Targeting
+};
+
+#endif // !RANDOM_SUBSYSTEM_H
@@ -0,0 +1,129 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "GhostAnimation.h"
+
+/// <summary>
+/// What the renderer needs to draw one ghost.
+/// </summary>
+struct GhostSnapshot
+{
+	/// <summary>
+	/// The position of the ghost before the last tick.
+	/// </summary>
+	sf::Vector2f previousPosition;
+
+	/// <summary>
+	/// The position of the ghost after the last tick.
+	/// </summary>
+	sf::Vector2f position;
+
+	/// <summary>
+	/// The dimensions of the ghost.
+	/// </summary>
+	sf::Vector2f size;
+
+	/// <summary>
+	/// The offset of the position from the top left corner of the ghost.
+	/// </summary>
+	sf::Vector2f origin;
+
+	/// <summary>
+	/// The current animation frame of the ghost.
+	/// </summary>
+	GhostAnimation animation;
+
+	/// <summary>
+	/// Is true if the ghost faces left.
+	/// </summary>
+	bool isMirrored;
+};
+
+/// <summary>
+/// What the renderer needs to draw one projectile.
+/// </summary>
+struct ProjectileSnapshot
+{
+	/// <summary>
+	/// The center of the projectile before the last tick.
+	/// </summary>
+	sf::Vector2f previousPosition;
+
+	/// <summary>
+	/// The center of the projectile after the last tick.
+	/// </summary>
+	sf::Vector2f position;
+
+	/// <summary>
+	/// The dimensions of the projectile.
+	/// </summary>
+	sf::Vector2f size;
+};
+
+/// <summary>
+/// A copy of everything the swarm defense screen draws, taken by the simulation thread after a tick. Once published it is only read, so
+/// the renderer can draw it while the simulation carries on with the next tick.
+/// </summary>
+struct RenderSnapshot
+{
+	/// <summary>
+	/// Every ghost, in the order they are drawn.
+	/// </summary>
+	std::vector<GhostSnapshot> ghosts;
+
+	/// <summary>
+	/// Every projectile in flight.
+	/// </summary>
+	std::vector<ProjectileSnapshot> projectiles;
+
+	/// <summary>
+	/// The player's score.
+	/// </summary>
+	unsigned int score = 0;
+
+	/// <summary>
+	/// The player's coins.
+	/// </summary>
+	unsigned int coins = 0;
+
+	/// <summary>
+	/// The health of the player's base.
+	/// </summary>
+	unsigned short int health = 0;
+
+	/// <summary>
+	/// Is true once the player's base has been destroyed.
+	/// </summary>
+	bool isGameOver = false;
+
+	/// <summary>
+	/// The number of projectiles that hit an enemy since the simulation started. Compared between snapshots to play a sound once per
+	/// tick with hits, even when the renderer skips snapshots.
+	/// </summary>
+	unsigned long totalHits = 0;
+
+	/// <summary>
+	/// The number of enemies that reached the base since the simulation started.
+	/// </summary>
+	unsigned long totalExplosions = 0;
+
+	/// <summary>
+	/// The number of queued purchases the simulation has applied, whether or not the player could afford them. Tells the renderer which
+	/// of the purchases it queued are already reflected in coins.
+	/// </summary>
+	unsigned long purchasesApplied = 0;
+
+	/// <summary>
+	/// The number of ticks stepped when the snapshot was taken. 0 if the snapshot was never written.
+	/// </summary>
+	unsigned long tick = 0;
+
+	/// <summary>
+	/// When the snapshot was published, in microseconds on the clock of the simulation thread.
+	/// </summary>
+	sf::Int64 publishedMicroseconds = 0;
+};
+
+#endif // !RENDER_SNAPSHOT_H
@@ -0,0 +1,150 @@
+#include "ResourceCache.h"
+
+ResourceCache& ResourceCache::getInstance()
+{
+	static ResourceCache instance;
+	return instance;
+}
+
+ResourceCache::ResourceCache()
+{
+	stats.hits = 0;
+	stats.loads = 0;
+	stats.failures = 0;
+	stats.evictions = 0;
+	stats.resident = 0;
+}
+
+std::shared_ptr<const sf::Texture> ResourceCache::getTexture(const std::string& path, bool isRepeated)
+{
+	return get(textures, isRepeated ? path + "#repeated" : path, [&path, isRepeated](sf::Texture& texture)
+		{
+			if (!texture.loadFromFile(path)) return false;
+
+			texture.setRepeated(isRepeated);
+			return true;
+		});
+}
+
+std::shared_ptr<const FontAtlas> ResourceCache::getFontAtlas(const std::string& path)
+{
+	return get(fontAtlases, path, [&path](FontAtlas& atlas) { return atlas.load(path); });
+}
+
+std::shared_ptr<const sf::SoundBuffer> ResourceCache::getSoundBuffer(const std::string& path)
+{
+	return get(soundBuffers, path, [&path](sf::SoundBuffer& soundBuffer) { return soundBuffer.loadFromFile(path); });
+}
+
+std::shared_ptr<const TextureAtlas> ResourceCache::getTextureAtlas(const std::string& specPath, const std::string& atlasName)
+{
+	return get(textureAtlases, getTextureAtlasKey(specPath, atlasName), [&specPath, &atlasName](TextureAtlas& atlas) { return atlas.load(specPath, atlasName); });
+}
+
+bool ResourceCache::hasSoundBuffer(const std::string& path)
+{
+	return contains(soundBuffers, path);
+}
+
+bool ResourceCache::hasTextureAtlas(const std::string& specPath, const std::string& atlasName)
+{
+	return contains(textureAtlases, getTextureAtlasKey(specPath, atlasName));
+}
+
+void ResourceCache::addSoundBuffer(const std::string& path, std::shared_ptr<const sf::SoundBuffer> soundBuffer, bool didLoad)
+{
+	add(soundBuffers, path, soundBuffer, didLoad);
+}
+
+void ResourceCache::addTextureAtlas(const std::string& specPath, const std::string& atlasName, std::shared_ptr<const TextureAtlas> atlas, bool didLoad)
+{
+	add(textureAtlases, getTextureAtlasKey(specPath, atlasName), atlas, didLoad);
+}
+
+unsigned int ResourceCache::evictUnused()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	unsigned int evicted = evictUnused(textures) + evictUnused(fontAtlases) + evictUnused(soundBuffers) + evictUnused(textureAtlases);
+	stats.evictions += evicted;
+	stats.resident -= evicted;
+	return evicted;
+}
+
+ResourceCacheStats ResourceCache::getStats()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return stats;
+}
+
+template <typename Resource, typename Loader>
+std::shared_ptr<const Resource> ResourceCache::get(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key, Loader load)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	typename std::map<std::string, std::shared_ptr<const Resource>>::iterator found = resources.find(key);
+	if (found != resources.end())
+	{
+		stats.hits++;
+		return found->second;
+	}
+
+	std::shared_ptr<Resource> resource = std::make_shared<Resource>();
+	stats.loads++;
+	if (!load(*resource))
+	{
+		std::cout << "Failed to load resource " << key << "." << std::endl;
+		stats.failures++;
+	}
+
+	resources[key] = resource;
+	stats.resident++;
+	return resource;
+}
+
+template <typename Resource>
+bool ResourceCache::contains(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return resources.find(key) != resources.end();
+}
+
+template <typename Resource>
+void ResourceCache::add(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key, std::shared_ptr<const Resource> resource, bool didLoad)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (resources.find(key) != resources.end()) return;
+
+	stats.loads++;
+	if (!didLoad)
+	{
+		std::cout << "Failed to load resource " << key << "." << std::endl;
+		stats.failures++;
+	}
+
+	resources[key] = resource;
+	stats.resident++;
+}
+
+std::string ResourceCache::getTextureAtlasKey(const std::string& specPath, const std::string& atlasName)
+{
+	return specPath + "#" + atlasName;
+}
+
+template <typename Resource>
+unsigned int ResourceCache::evictUnused(std::map<std::string, std::shared_ptr<const Resource>>& resources)
+{
+	unsigned int evicted = 0;
+	typename std::map<std::string, std::shared_ptr<const Resource>>::iterator i = resources.begin();
+	while (i != resources.end())
+	{
+		if (i->second.use_count() == 1)
+		{
+			i = resources.erase(i);
+			evicted++;
+		}
+		else {
+			++i;
+		}
+	}
+
+	return evicted;
+}
@@ -0,0 +1,222 @@
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <iostream>
+#include "TextureAtlas.h"
+#include "FontAtlas.h"
+
+/// <summary>
+/// Counters describing how the resource cache has been used since the program started.
+/// </summary>
+struct ResourceCacheStats
+{
+	/// <summary>
+	/// The number of requests served by a resource that was already loaded.
+	/// </summary>
+	unsigned int hits;
+
+	/// <summary>
+	/// The number of requests that loaded a resource from disk.
+	/// </summary>
+	unsigned int loads;
+
+	/// <summary>
+	/// The number of loads that failed. A failed resource is still cached, empty, so the file is not opened again.
+	/// </summary>
+	unsigned int failures;
+
+	/// <summary>
+	/// The number of resources removed by evictUnused.
+	/// </summary>
+	unsigned int evictions;
+
+	/// <summary>
+	/// The number of resources currently held by the cache.
+	/// </summary>
+	unsigned int resident;
+};
+
+/// <summary>
+/// A process-wide cache of textures, font atlases, sound buffers and texture atlases, keyed by path. Each resource is loaded the first time it
+/// is requested and shared by every later request, so screens and components that need the same file no longer load it again. Resources
+/// stay cached after their last user releases them until evictUnused is called.
+/// </summary>
+class ResourceCache
+{
+public:
+	/// <summary>
+	/// Gets the cache shared by the whole program.
+	/// </summary>
+	/// <returns>The shared cache.</returns>
+	static ResourceCache& getInstance();
+
+	/// <summary>
+	/// Gets the texture loaded from the provided path, loading it if this is the first request.
+	/// </summary>
+	/// <param name="path">The path of the image file.</param>
+	/// <param name="isRepeated">Whether the texture repeats when drawn outside its bounds. Repeated and non-repeated textures of the same
+	/// file are cached separately.</param>
+	/// <returns>The shared texture. Empty if the file could not be loaded.</returns>
+	std::shared_ptr<const sf::Texture> getTexture(const std::string& path, bool isRepeated = false);
+
+	/// <summary>
+	/// Gets the atlas of the standard faces of the font at the provided path, building it if this is the first request.
+	/// </summary>
+	/// <param name="path">The path of the font file.</param>
+	/// <returns>The shared font atlas. Empty if the font could not be loaded.</returns>
+	std::shared_ptr<const FontAtlas> getFontAtlas(const std::string& path);
+
+	/// <summary>
+	/// Gets the sound buffer loaded from the provided path, loading it if this is the first request.
+	/// </summary>
+	/// <param name="path">The path of the sound file.</param>
+	/// <returns>The shared sound buffer. Empty if the file could not be loaded.</returns>
+	std::shared_ptr<const sf::SoundBuffer> getSoundBuffer(const std::string& path);
+
+	/// <summary>
+	/// Gets the texture atlas with the provided name from the provided spec file, loading it if this is the first request.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas.</param>
+	/// <returns>The shared atlas. Empty if the atlas could not be loaded.</returns>
+	std::shared_ptr<const TextureAtlas> getTextureAtlas(const std::string& specPath, const std::string& atlasName);
+
+	/// <summary>
+	/// Returns true if a sound buffer loaded from the provided path is cached.
+	/// </summary>
+	/// <param name="path">The path of the sound file.</param>
+	/// <returns>True if the sound buffer is cached.</returns>
+	bool hasSoundBuffer(const std::string& path);
+
+	/// <summary>
+	/// Returns true if the texture atlas with the provided name from the provided spec file is cached.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas.</param>
+	/// <returns>True if the atlas is cached.</returns>
+	bool hasTextureAtlas(const std::string& specPath, const std::string& atlasName);
+
+	/// <summary>
+	/// Caches a sound buffer that was loaded elsewhere, such as by the asset loader, as if it had been loaded from the provided path.
+	/// Does nothing if a sound buffer is already cached for the path.
+	/// </summary>
+	/// <param name="path">The path of the sound file.</param>
+	/// <param name="soundBuffer">The loaded sound buffer.</param>
+	/// <param name="didLoad">Whether the sound buffer was loaded. Counted as a failure if not.</param>
+	void addSoundBuffer(const std::string& path, std::shared_ptr<const sf::SoundBuffer> soundBuffer, bool didLoad);
+
+	/// <summary>
+	/// Caches a texture atlas that was loaded elsewhere, such as by the asset loader, as if it had been loaded from the provided spec file.
+	/// Does nothing if the atlas is already cached.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas.</param>
+	/// <param name="atlas">The loaded atlas.</param>
+	/// <param name="didLoad">Whether the atlas was loaded. Counted as a failure if not.</param>
+	void addTextureAtlas(const std::string& specPath, const std::string& atlasName, std::shared_ptr<const TextureAtlas> atlas, bool didLoad);
+
+	/// <summary>
+	/// Removes every resource that is no longer used outside the cache.
+	/// </summary>
+	/// <returns>The number of resources removed.</returns>
+	unsigned int evictUnused();
+
+	/// <summary>
+	/// Gets the usage counters of the cache.
+	/// </summary>
+	/// <returns>The usage counters of the cache.</returns>
+	ResourceCacheStats getStats();
+
+private:
+	/// <summary>
+	/// Initializes an empty cache. Use getInstance instead.
+	/// </summary>
+	ResourceCache();
+
+	ResourceCache(const ResourceCache&) = delete;
+
+	ResourceCache& operator=(const ResourceCache&) = delete;
+
+	/// <summary>
+	/// The cached textures, by path.
+	/// </summary>
+	std::map<std::string, std::shared_ptr<const sf::Texture>> textures;
+
+	/// <summary>
+	/// The cached font atlases, by font path.
+	/// </summary>
+	std::map<std::string, std::shared_ptr<const FontAtlas>> fontAtlases;
+
+	/// <summary>
+	/// The cached sound buffers, by path.
+	/// </summary>
+	std::map<std::string, std::shared_ptr<const sf::SoundBuffer>> soundBuffers;
+
+	/// <summary>
+	/// The cached texture atlases, by spec path and atlas name.
+	/// </summary>
+	std::map<std::string, std::shared_ptr<const TextureAtlas>> textureAtlases;
+
+	/// <summary>
+	/// The usage counters of the cache.
+	/// </summary>
+	ResourceCacheStats stats;
+
+	/// <summary>
+	/// Guards the cached resources and the counters so resources can be requested from more than one thread.
+	/// </summary>
+	std::mutex mutex;
+
+	/// <summary>
+	/// Returns the cached resource with the provided key, or loads, caches and returns it.
+	/// </summary>
+	/// <param name="resources">The cached resources of the requested type.</param>
+	/// <param name="key">The key of the resource.</param>
+	/// <param name="load">Loads the resource, returning false on failure.</param>
+	/// <returns>The shared resource.</returns>
+	template <typename Resource, typename Loader>
+	std::shared_ptr<const Resource> get(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key, Loader load);
+
+	/// <summary>
+	/// Returns true if a resource with the provided key is cached.
+	/// </summary>
+	/// <param name="resources">The cached resources of one type.</param>
+	/// <param name="key">The key of the resource.</param>
+	/// <returns>True if the resource is cached.</returns>
+	template <typename Resource>
+	bool contains(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key);
+
+	/// <summary>
+	/// Caches the provided resource under the provided key unless a resource is already cached under it.
+	/// </summary>
+	/// <param name="resources">The cached resources of one type.</param>
+	/// <param name="key">The key of the resource.</param>
+	/// <param name="resource">The loaded resource.</param>
+	/// <param name="didLoad">Whether the resource was loaded.</param>
+	template <typename Resource>
+	void add(std::map<std::string, std::shared_ptr<const Resource>>& resources, const std::string& key, std::shared_ptr<const Resource> resource, bool didLoad);
+
+	/// <summary>
+	/// Gets the key of the texture atlas with the provided name from the provided spec file.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas.</param>
+	/// <returns>The key of the atlas.</returns>
+	static std::string getTextureAtlasKey(const std::string& specPath, const std::string& atlasName);
+
+	/// <summary>
+	/// Removes every resource of one type that is no longer used outside the cache.
+	/// </summary>
+	/// <param name="resources">The cached resources of one type.</param>
+	/// <returns>The number of resources removed.</returns>
+	template <typename Resource>
+	unsigned int evictUnused(std::map<std::string, std::shared_ptr<const Resource>>& resources);
+};
+
+#endif // !RESOURCE_CACHE_H
@@ -1,8 +1,11 @@
 #include "ScreenManager.h"
 
-ScreenManager::ScreenManager(sf::VideoMode vm)
+const static unsigned int assetsFinalizedPerUpdate = 1;
+
+ScreenManager::ScreenManager(sf::VideoMode vm, sf::Int64 tickLength)
 {
 	videoMode = vm;
+	tickMicroseconds = tickLength;
 	mainMenu = new MainMenu(videoMode, this, &ScreenManager::handleConnectToNetwork);
 	currentScreen = Screens::MainMenu;
 	howToPlayMenu = new HowToPlayMenu(videoMode);
@@ -10,6 +13,7 @@ ScreenManager::ScreenManager(sf::VideoMode vm)
 	server = nullptr;
 	client = nullptr;
 	loadingModal = nullptr;
+	assetLoader = nullptr;
 	isAttemptingToConnect = false;
 }
 
@@ -20,6 +24,8 @@ ScreenManager::~ScreenManager()
 	server = nullptr;
 	delete client;
 	client = nullptr;
+	delete assetLoader;
+	assetLoader = nullptr;
 	delete loadingModal;
 	loadingModal = nullptr;
 }
@@ -51,6 +57,12 @@ void ScreenManager::updateState()
 		return;
 	}
 
+	if (assetLoader != nullptr)
+	{
+		continueLoadingSwarmDefense();
+		return;
+	}
+
 	currentScreenPtr->processKeyboardInput();
 	currentScreenPtr->processMousePosition(sf::Mouse::getPosition());
 	currentScreenPtr->updateState();
@@ -138,10 +150,14 @@ void ScreenManager::initializeSelectedScreen(Screens selectedScreen)
 	switch (selectedScreen)
 	{
 	case Screens::MainMenu:
+		// Deleting the match stops its simulation thread, so nothing keeps stepping it while the menu is shown.
+		delete swarmDefense;
+		swarmDefense = nullptr;
 		mainMenu->resetState();
 		break;
 	case Screens::SwarmDefense:
-		swarmDefense = new SwarmDefense(videoMode, isMultiplayer(), this, &ScreenManager::sendEnemiesToOpponent, &ScreenManager::getEnemiesFromOpponent);
+		delete swarmDefense;
+		swarmDefense = new SwarmDefense(videoMode, isMultiplayer(), this, &ScreenManager::sendEnemiesToOpponent, &ScreenManager::getEnemiesFromOpponent, tickMicroseconds);
 		break;
 	case Screens::HowToPlayMenu: 
 		howToPlayMenu->resetState();
@@ -173,11 +189,43 @@ void ScreenManager::deleteAllScreens()
 
 void ScreenManager::switchToSelectedScreen(Screens selectedScreen)
 {
+	if (selectedScreen == Screens::SwarmDefense)
+	{
+		beginLoadingSwarmDefense();
+		return;
+	}
+
 	//deleteAllScreens();
 	initializeSelectedScreen(selectedScreen);
 	currentScreen = selectedScreen;
 }
 
+void ScreenManager::beginLoadingSwarmDefense()
+{
+	assetLoader = new AssetLoader();
+	SwarmDefense::requestAssets(*assetLoader);
+	assetLoader->start();
+
+	if (loadingModal == nullptr) loadingModal = new LoadingModal(videoMode);
+	loadingModal->setProgress(assetLoader->getProgress());
+	continueLoadingSwarmDefense();
+}
+
+void ScreenManager::continueLoadingSwarmDefense()
+{
+	loadingModal->updateState();
+	assetLoader->finalize(assetsFinalizedPerUpdate);
+	loadingModal->setProgress(assetLoader->getProgress());
+	if (!assetLoader->getIsDone()) return;
+
+	delete assetLoader;
+	assetLoader = nullptr;
+	delete loadingModal;
+	loadingModal = nullptr;
+	initializeSelectedScreen(Screens::SwarmDefense);
+	currentScreen = Screens::SwarmDefense;
+}
+
 void ScreenManager::attemptConnection()
 {
 	if (server != nullptr)
@@ -11,6 +11,7 @@
 #include "TcpClient.h"
 #include "TcpServer.h"
 #include "LoadingModal.h"
+#include "AssetLoader.h"
 
 /// <summary>
 /// This class manages the various screens and is the second layer below the main function.
@@ -22,7 +23,8 @@ public:
 	/// Initializes the video mode that will render the various screens.
 	/// </summary>
 	/// <param name="vm"></param>
-	ScreenManager(sf::VideoMode vm);
+	/// <param name="tickLength">The simulated time in microseconds of each call to updateState.</param>
+	ScreenManager(sf::VideoMode vm, sf::Int64 tickLength);
 
 	~ScreenManager();
 
@@ -114,6 +116,11 @@ private:
 	/// </summary>
 	sf::VideoMode videoMode;
 
+	/// <summary>
+	/// The simulated time in microseconds of each call to updateState.
+	/// </summary>
+	sf::Int64 tickMicroseconds;
+
 	/// <summary>
 	/// The SFML server implementation.
 	/// </summary>
@@ -134,6 +141,21 @@ private:
 	/// </summary>
 	bool isAttemptingToConnect;
 
+	/// <summary>
+	/// Streams the assets of the swarm defense screen while the loading modal is shown. Null when nothing is loading.
+	/// </summary>
+	AssetLoader* assetLoader;
+
+	/// <summary>
+	/// Starts streaming the assets of the swarm defense screen and shows the loading modal until they are ready.
+	/// </summary>
+	void beginLoadingSwarmDefense();
+
+	/// <summary>
+	/// Finalizes some of the streamed assets, updates the loading modal and switches to the swarm defense screen once every asset is ready.
+	/// </summary>
+	void continueLoadingSwarmDefense();
+
 	/// <summary>
 	/// Attempt to connect to another player on the network.
 	/// </summary>
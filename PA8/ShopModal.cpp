@@ -37,6 +37,18 @@ ShopModal::ShopModal(
 	basicWeaponDescription->snapToHorizontal(videoMode, 16, 9);
 	basicWeaponDescription->snapToVertical(videoMode, 16, 6);
 
+	seekingWeaponName = new TextComponent("Leander.ttf", "Seeking", 30);
+	seekingWeaponName->snapToHorizontal(videoMode, 16, 4);
+	seekingWeaponName->snapToVertical(videoMode, 16, 7);
+
+	seekingWeaponCost = new TextComponent("Leander.ttf", "30", 30);
+	seekingWeaponCost->snapToHorizontal(videoMode, 16, 6);
+	seekingWeaponCost->snapToVertical(videoMode, 16, 7);
+
+	seekingWeaponDescription = new TextComponent("Leander.ttf", "Fires 2 projectiles at the closest ghosts.", 30);
+	seekingWeaponDescription->snapToHorizontal(videoMode, 16, 9);
+	seekingWeaponDescription->snapToVertical(videoMode, 16, 7);
+
 	exitButton = new TextComponent("Leander.ttf", "Exit", 30);
 	exitButton->centerHorizontal(videoMode);
 	exitButton->snapToVertical(videoMode, 16, 13);
@@ -45,6 +57,7 @@ ShopModal::ShopModal(
 	onPurchaseWeapon = purchaseWeaponCallback;
 	onCloseModal = closeModalCallback;
 	currentBasicWeaponCost = 10;
+	currentSeekingWeaponCost = 30;
 }
 
 ShopModal::~ShopModal()
@@ -63,6 +76,12 @@ ShopModal::~ShopModal()
 	basicWeaponCost = nullptr;
 	delete basicWeaponDescription;
 	basicWeaponDescription = nullptr;
+	delete seekingWeaponName;
+	seekingWeaponName = nullptr;
+	delete seekingWeaponCost;
+	seekingWeaponCost = nullptr;
+	delete seekingWeaponDescription;
+	seekingWeaponDescription = nullptr;
 	delete exitButton;
 	exitButton = nullptr;
 }
@@ -77,6 +96,9 @@ void ShopModal::drawTo(sf::RenderWindow& window)
 	weaponDescriptionTableHeader->drawTo(window);
 	basicWeaponCost->drawTo(window);
 	basicWeaponDescription->drawTo(window);
+	seekingWeaponName->drawTo(window);
+	seekingWeaponCost->drawTo(window);
+	seekingWeaponDescription->drawTo(window);
 	exitButton->drawTo(window);
 }
 
@@ -108,6 +130,15 @@ void ShopModal::handlePurchaseBasicWeapon()
 
 }
 
+void ShopModal::handlePurchaseSeekingWeapon()
+{
+	if (((*parent).*onPurchaseWeapon)(currentSeekingWeaponCost, WeaponType::Seeking))
+	{
+		currentSeekingWeaponCost *= 2;
+		seekingWeaponCost->setText(std::to_string(currentSeekingWeaponCost));
+	}
+}
+
 void ShopModal::handleClickEvent(sf::Event event)
 {
 	if (event.type != sf::Event::MouseButtonReleased || event.mouseButton.button != sf::Mouse::Left) return;
@@ -119,6 +150,12 @@ void ShopModal::handleClickEvent(sf::Event event)
 		return;
 	}
 
+	if (seekingWeaponName->isPositionInMyArea(mousePosition))
+	{
+		handlePurchaseSeekingWeapon();
+		return;
+	}
+
 	if (exitButton->isPositionInMyArea(mousePosition))
 	{
 		((*parent).*onCloseModal)();
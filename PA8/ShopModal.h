@@ -70,6 +70,21 @@ private:
 	/// </summary>
 	TextComponent* basicWeaponDescription;
 
+	/// <summary>
+	/// The text component containing the name of the seeking weapon.
+	/// </summary>
+	TextComponent* seekingWeaponName;
+
+	/// <summary>
+	/// The text component containing the cost of the seeking weapon.
+	/// </summary>
+	TextComponent* seekingWeaponCost;
+
+	/// <summary>
+	/// The text component containing the description of the seeking weapon.
+	/// </summary>
+	TextComponent* seekingWeaponDescription;
+
 	/// <summary>
 	/// The text component representing the exit button.
 	/// </summary>
@@ -105,6 +120,16 @@ private:
 	/// </summary>
 	unsigned int currentBasicWeaponCost;
 
+	/// <summary>
+	/// Processes a user request to purchase a seeking weapon.
+	/// </summary>
+	void handlePurchaseSeekingWeapon();
+
+	/// <summary>
+	/// The current cost of the seeking weapon.
+	/// </summary>
+	unsigned int currentSeekingWeaponCost;
+
 	/// <summary>
 	/// Handles a click event.
 	/// </summary>
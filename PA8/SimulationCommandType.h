@@ -0,0 +1,13 @@
+#ifndef SIMULATION_COMMAND_TYPE_H
+#define SIMULATION_COMMAND_TYPE_H
+
+/// <summary>
+/// Enum representing the player inputs the render thread passes to the simulation thread.
+/// </summary>
+enum class SimulationCommandType
+{
+	FireProjectile,
+	PurchaseWeapon
+};
+
+#endif // !SIMULATION_COMMAND_TYPE_H
@@ -0,0 +1,144 @@
+#include "SimulationThread.h"
+
+// The most ticks run in one wake-up, so a stall of the simulation thread is dropped rather than caught up on.
+const static unsigned int maxTicksPerWake = 5;
+
+SimulationThread::SimulationThread(SwarmSimulation& sim, sf::Int64 tickLength)
+	: simulation(sim), timestep((unsigned int)(1000000 / std::max(tickLength, (sf::Int64)1)), maxTicksPerWake)
+{
+	tickMicroseconds = tickLength;
+	tickCount = 0;
+	totalHits = 0;
+	totalExplosions = 0;
+	purchasesApplied = 0;
+	isStopping = false;
+	hasQueuedCommands = false;
+}
+
+SimulationThread::~SimulationThread()
+{
+	stop();
+}
+
+void SimulationThread::start()
+{
+	if (thread.joinable()) return;
+
+	publishSnapshot();
+	isStopping = false;
+	thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop()
+{
+	isStopping = true;
+	if (thread.joinable()) thread.join();
+}
+
+void SimulationThread::fireProjectileAt(sf::Vector2f position)
+{
+	SimulationCommand command;
+	command.type = SimulationCommandType::FireProjectile;
+	command.position = position;
+	command.cost = 0;
+	command.weaponType = WeaponType::Basic;
+	queue(command);
+}
+
+void SimulationThread::purchaseWeapon(unsigned int cost, WeaponType type)
+{
+	SimulationCommand command;
+	command.type = SimulationCommandType::PurchaseWeapon;
+	command.cost = cost;
+	command.weaponType = type;
+	queue(command);
+}
+
+bool SimulationThread::acquireSnapshot()
+{
+	return snapshots.acquire();
+}
+
+const RenderSnapshot& SimulationThread::getSnapshot() const
+{
+	return snapshots.getReadBuffer();
+}
+
+float SimulationThread::getInterpolation(const RenderSnapshot& snapshot) const
+{
+	if (snapshot.isGameOver) return 1.0f;
+
+	sf::Int64 sincePublished = clock.getElapsedTime().asMicroseconds() - snapshot.publishedMicroseconds;
+	return std::min(std::max((float)sincePublished / (float)tickMicroseconds, 0.0f), 1.0f);
+}
+
+void SimulationThread::queue(const SimulationCommand& command)
+{
+	std::lock_guard<std::mutex> lock(commandMutex);
+	queuedCommands.push_back(command);
+	hasQueuedCommands = true;
+}
+
+void SimulationThread::applyCommands()
+{
+	if (!hasQueuedCommands.load()) return;
+
+	{
+		std::lock_guard<std::mutex> lock(commandMutex);
+		takenCommands.swap(queuedCommands);
+		hasQueuedCommands = false;
+	}
+
+	for (const SimulationCommand& command : takenCommands)
+	{
+		switch (command.type)
+		{
+		case SimulationCommandType::FireProjectile:
+			simulation.fireProjectileAt(command.position);
+			break;
+		case SimulationCommandType::PurchaseWeapon:
+			simulation.purchaseWeapon(command.cost, command.weaponType);
+			purchasesApplied++;
+			break;
+		default:
+			break;
+		}
+	}
+
+	takenCommands.clear();
+}
+
+void SimulationThread::publishSnapshot()
+{
+	RenderSnapshot& snapshot = snapshots.getWriteBuffer();
+	simulation.writeSnapshot(snapshot);
+	snapshot.totalHits = totalHits;
+	snapshot.totalExplosions = totalExplosions;
+	snapshot.purchasesApplied = purchasesApplied;
+	snapshot.tick = tickCount;
+	snapshot.publishedMicroseconds = clock.getElapsedTime().asMicroseconds();
+	snapshots.publish();
+}
+
+void SimulationThread::run()
+{
+	sf::Clock wakeClock;
+	while (!isStopping.load())
+	{
+		unsigned int ticks = timestep.advance(wakeClock.restart().asMicroseconds());
+		bool didStep = false;
+		for (unsigned int tick = 0; tick < ticks && !simulation.getIsGameOver(); tick++)
+		{
+			applyCommands();
+			simulation.step(tickMicroseconds);
+			totalHits += simulation.getHitsLastStep();
+			totalExplosions += simulation.getExplosionsLastStep();
+			tickCount++;
+			didStep = true;
+		}
+
+		if (didStep) publishSnapshot();
+
+		sf::sleep(sf::microseconds((sf::Int64)((1.0f - timestep.getInterpolation()) * (float)tickMicroseconds)));
+	}
+}
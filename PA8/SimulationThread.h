@@ -0,0 +1,204 @@
+#ifndef SIMULATION_THREAD_H
+#define SIMULATION_THREAD_H
+
+#include <SFML/System.hpp>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include "SwarmSimulation.h"
+#include "FixedTimestep.h"
+#include "TripleBuffer.h"
+#include "RenderSnapshot.h"
+#include "SimulationCommandType.h"
+#include "WeaponType.h"
+
+/// <summary>
+/// A player input waiting to be applied by the simulation thread.
+/// </summary>
+struct SimulationCommand
+{
+	/// <summary>
+	/// What the player did.
+	/// </summary>
+	SimulationCommandType type;
+
+	/// <summary>
+	/// The coordinate to fire at.
+	/// </summary>
+	sf::Vector2f position;
+
+	/// <summary>
+	/// The cost of the weapon to purchase.
+	/// </summary>
+	unsigned int cost;
+
+	/// <summary>
+	/// The type of weapon to purchase.
+	/// </summary>
+	WeaponType weaponType;
+};
+
+/// <summary>
+/// Steps a swarm simulation on its own thread at a fixed tick rate, so a slow frame does not hold up the game and a slow tick does not
+/// hold up drawing. After the ticks of each wake-up the thread publishes a render snapshot into a triple buffer that the render thread
+/// reads whenever it draws. Neither side locks to hand over a snapshot. Player input goes the other way through a short list that is
+/// only locked when it holds input. The simulation must not be touched by any other thread while this one runs.
+/// </summary>
+class SimulationThread
+{
+public:
+	/// <summary>
+	/// Initializes the tick length. The thread does not start until start is called.
+	/// </summary>
+	/// <param name="sim">The simulation to step. Must outlive this object.</param>
+	/// <param name="tickLength">The simulated and real time in microseconds of each tick.</param>
+	SimulationThread(SwarmSimulation& sim, sf::Int64 tickLength);
+
+	/// <summary>
+	/// Stops and joins the thread.
+	/// </summary>
+	~SimulationThread();
+
+	/// <summary>
+	/// Publishes a snapshot of the current state and starts stepping the simulation on a new thread.
+	/// </summary>
+	void start();
+
+	/// <summary>
+	/// Stops and joins the thread. The simulation may be used from the calling thread afterwards.
+	/// </summary>
+	void stop();
+
+	/// <summary>
+	/// Queues a projectile to be fired at the provided coordinate before the next tick.
+	/// </summary>
+	/// <param name="position">The coordinate to fire at.</param>
+	void fireProjectileAt(sf::Vector2f position);
+
+	/// <summary>
+	/// Queues a weapon to be purchased before the next tick. The simulation still checks the player can afford it.
+	/// </summary>
+	/// <param name="cost">The cost of the weapon.</param>
+	/// <param name="type">The type of weapon to purchase.</param>
+	void purchaseWeapon(unsigned int cost, WeaponType type);
+
+	/// <summary>
+	/// Moves onto the most recently published snapshot. Only called by the render thread.
+	/// </summary>
+	/// <returns>True if a newer snapshot was published since the last call.</returns>
+	bool acquireSnapshot();
+
+	/// <summary>
+	/// Gets the snapshot acquired last. It stays valid and unchanged until the next call to acquireSnapshot.
+	/// </summary>
+	/// <returns>The snapshot acquired last.</returns>
+	const RenderSnapshot& getSnapshot() const;
+
+	/// <summary>
+	/// Gets how far the real time since the provided snapshot was published is into the next tick, so moving objects can be drawn between
+	/// their previous and current positions.
+	/// </summary>
+	/// <param name="snapshot">A snapshot published by this thread.</param>
+	/// <returns>A value from 0 to 1.</returns>
+	float getInterpolation(const RenderSnapshot& snapshot) const;
+
+private:
+	/// <summary>
+	/// The simulation stepped by the thread.
+	/// </summary>
+	SwarmSimulation& simulation;
+
+	/// <summary>
+	/// The simulated and real time in microseconds of each tick.
+	/// </summary>
+	sf::Int64 tickMicroseconds;
+
+	/// <summary>
+	/// Turns the real time between wake-ups into whole ticks.
+	/// </summary>
+	FixedTimestep timestep;
+
+	/// <summary>
+	/// Measures when snapshots are published. Read by both threads.
+	/// </summary>
+	sf::Clock clock;
+
+	/// <summary>
+	/// The snapshots handed from the simulation thread to the render thread.
+	/// </summary>
+	TripleBuffer<RenderSnapshot> snapshots;
+
+	/// <summary>
+	/// The number of ticks stepped so far.
+	/// </summary>
+	unsigned long tickCount;
+
+	/// <summary>
+	/// The number of projectiles that hit an enemy since the thread started.
+	/// </summary>
+	unsigned long totalHits;
+
+	/// <summary>
+	/// The number of enemies that reached the base since the thread started.
+	/// </summary>
+	unsigned long totalExplosions;
+
+	/// <summary>
+	/// The number of queued purchases applied since the thread started.
+	/// </summary>
+	unsigned long purchasesApplied;
+
+	/// <summary>
+	/// The thread stepping the simulation.
+	/// </summary>
+	std::thread thread;
+
+	/// <summary>
+	/// Is set to true to make the thread return.
+	/// </summary>
+	std::atomic<bool> isStopping;
+
+	/// <summary>
+	/// Guards queuedCommands.
+	/// </summary>
+	std::mutex commandMutex;
+
+	/// <summary>
+	/// The inputs queued by the render thread since the simulation thread last took them.
+	/// </summary>
+	std::vector<SimulationCommand> queuedCommands;
+
+	/// <summary>
+	/// The inputs taken from queuedCommands and being applied. Only touched by the simulation thread.
+	/// </summary>
+	std::vector<SimulationCommand> takenCommands;
+
+	/// <summary>
+	/// Is true when queuedCommands holds input, so the simulation thread only locks when there is something to take.
+	/// </summary>
+	std::atomic<bool> hasQueuedCommands;
+
+	/// <summary>
+	/// Adds the provided input to queuedCommands.
+	/// </summary>
+	/// <param name="command">The input to queue.</param>
+	void queue(const SimulationCommand& command);
+
+	/// <summary>
+	/// Takes the queued inputs and applies them to the simulation.
+	/// </summary>
+	void applyCommands();
+
+	/// <summary>
+	/// Writes the current state into the back snapshot and publishes it.
+	/// </summary>
+	void publishSnapshot();
+
+	/// <summary>
+	/// Steps the simulation whenever a tick is due until stopped. Run by the thread.
+	/// </summary>
+	void run();
+};
+
+#endif // !SIMULATION_THREAD_H
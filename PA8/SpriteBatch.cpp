@@ -0,0 +1,64 @@
+#include "SpriteBatch.h"
+
+SpriteBatch::SpriteBatch()
+{
+	vertices.setPrimitiveType(sf::Quads);
+}
+
+SpriteBatch::~SpriteBatch()
+{
+}
+
+void SpriteBatch::clear()
+{
+	vertices.clear();
+}
+
+void SpriteBatch::add(sf::Vector2f position, sf::Vector2f size, sf::Vector2f origin, const sf::IntRect& textureRect, bool isMirrored)
+{
+	float scaleX = isMirrored ? -1.0f : 1.0f;
+	float left = position.x - scaleX * origin.x;
+	float right = position.x + scaleX * (size.x - origin.x);
+	float top = position.y - origin.y;
+	float bottom = position.y + size.y - origin.y;
+
+	float textureLeft = (float)textureRect.left;
+	float textureRight = (float)(textureRect.left + textureRect.width);
+	float textureTop = (float)textureRect.top;
+	float textureBottom = (float)(textureRect.top + textureRect.height);
+
+	vertices.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(textureLeft, textureTop)));
+	vertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Vector2f(textureRight, textureTop)));
+	vertices.append(sf::Vertex(sf::Vector2f(right, bottom), sf::Vector2f(textureRight, textureBottom)));
+	vertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Vector2f(textureLeft, textureBottom)));
+}
+
+void SpriteBatch::add(sf::Vector2f center, sf::Vector2f size, sf::Color color)
+{
+	float left = center.x - size.x / 2.0f;
+	float right = center.x + size.x / 2.0f;
+	float top = center.y - size.y / 2.0f;
+	float bottom = center.y + size.y / 2.0f;
+
+	vertices.append(sf::Vertex(sf::Vector2f(left, top), color));
+	vertices.append(sf::Vertex(sf::Vector2f(right, top), color));
+	vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color));
+	vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color));
+}
+
+std::size_t SpriteBatch::getSpriteCount() const
+{
+	return vertices.getVertexCount() / 4;
+}
+
+const sf::VertexArray& SpriteBatch::getVertices() const
+{
+	return vertices;
+}
+
+void SpriteBatch::drawTo(sf::RenderWindow& window, const sf::Texture* texture)
+{
+	if (vertices.getVertexCount() == 0) return;
+
+	window.draw(vertices, sf::RenderStates(texture));
+}
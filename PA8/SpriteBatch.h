@@ -0,0 +1,69 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <SFML/Graphics.hpp>
+
+/// <summary>
+/// Collects many rectangles into a single quad vertex array so they can be drawn with one draw call. Every rectangle in a batch shares
+/// the texture passed to drawTo, so textured rectangles must come from the same atlas.
+/// </summary>
+class SpriteBatch
+{
+public:
+	/// <summary>
+	/// Initializes an empty batch.
+	/// </summary>
+	SpriteBatch();
+
+	~SpriteBatch();
+
+	/// <summary>
+	/// Removes every rectangle from the batch, keeping the memory of the vertex array for the next frame.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Adds a textured rectangle to the batch, placed the same way as an sf::RectangleShape with the same size, origin and position.
+	/// </summary>
+	/// <param name="position">The position of the origin of the rectangle.</param>
+	/// <param name="size">The width and height of the rectangle.</param>
+	/// <param name="origin">The origin of the rectangle relative to its top left corner.</param>
+	/// <param name="textureRect">The part of the texture to show in the rectangle.</param>
+	/// <param name="isMirrored">Whether to flip the rectangle horizontally around its origin.</param>
+	void add(sf::Vector2f position, sf::Vector2f size, sf::Vector2f origin, const sf::IntRect& textureRect, bool isMirrored);
+
+	/// <summary>
+	/// Adds a solid rectangle centered on the provided position. Only use in batches drawn without a texture.
+	/// </summary>
+	/// <param name="center">The center of the rectangle.</param>
+	/// <param name="size">The width and height of the rectangle.</param>
+	/// <param name="color">The fill color of the rectangle.</param>
+	void add(sf::Vector2f center, sf::Vector2f size, sf::Color color);
+
+	/// <summary>
+	/// Gets the number of rectangles in the batch.
+	/// </summary>
+	/// <returns>The number of rectangles in the batch.</returns>
+	std::size_t getSpriteCount() const;
+
+	/// <summary>
+	/// Gets the vertices of the batch, four per rectangle.
+	/// </summary>
+	/// <returns>The vertices of the batch.</returns>
+	const sf::VertexArray& getVertices() const;
+
+	/// <summary>
+	/// Draws every rectangle in the batch with a single draw call.
+	/// </summary>
+	/// <param name="window">The window to draw to.</param>
+	/// <param name="texture">The texture shared by the rectangles, or nullptr for solid rectangles.</param>
+	void drawTo(sf::RenderWindow& window, const sf::Texture* texture);
+
+private:
+	/// <summary>
+	/// The vertices of the batch, four per rectangle.
+	/// </summary>
+	sf::VertexArray vertices;
+};
+
+#endif // !SPRITE_BATCH_H
@@ -0,0 +1,372 @@
+#include "SwarmBenchmark.h"
+
+typedef std::chrono::steady_clock BenchmarkClock;
+
+const static std::size_t targetStride = 7919;
+
+SwarmBenchmark::SwarmBenchmark(int argc, char* argv[])
+{
+	ticks = 200;
+	warmupTicks = 120;
+	tickMicroseconds = 16667;
+	videoMode = sf::VideoMode(1920, 1080);
+	enemyCounts = { 1000, 10000, 100000 };
+	projectileCounts = { 100, 1000, 10000 };
+	boxCounts = { 64, 4096, 65536 };
+	seed = 1;
+	threadCount = 1;
+	hasError = false;
+	isShowingHelp = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string option = argv[i];
+		if (option == "--help")
+		{
+			isShowingHelp = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			std::cout << "Missing value for option " << option << std::endl;
+			hasError = true;
+			return;
+		}
+
+		std::string value = argv[++i];
+		try
+		{
+			if (option == "--ticks")
+			{
+				ticks = std::stoul(value);
+			}
+			else if (option == "--warmup")
+			{
+				warmupTicks = std::stoul(value);
+			}
+			else if (option == "--tick-us")
+			{
+				tickMicroseconds = std::stoll(value);
+			}
+			else if (option == "--width")
+			{
+				videoMode.width = std::stoul(value);
+			}
+			else if (option == "--height")
+			{
+				videoMode.height = std::stoul(value);
+			}
+			else if (option == "--enemies")
+			{
+				enemyCounts = parseCounts(value);
+			}
+			else if (option == "--projectiles")
+			{
+				projectileCounts = parseCounts(value);
+			}
+			else if (option == "--boxes")
+			{
+				boxCounts = parseCounts(value);
+			}
+			else if (option == "--seed")
+			{
+				seed = std::stoull(value);
+			}
+			else if (option == "--threads")
+			{
+				threadCount = std::stoul(value);
+			}
+			else {
+				std::cout << "Unknown option " << option << std::endl;
+				hasError = true;
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			std::cout << "Invalid value for option " << option << ": " << ex.what() << std::endl;
+			hasError = true;
+		}
+	}
+}
+
+SwarmBenchmark::~SwarmBenchmark()
+{
+}
+
+int SwarmBenchmark::run()
+{
+	if (isShowingHelp)
+	{
+		printUsage();
+		return hasError ? EXIT_FAILURE : EXIT_SUCCESS;
+	}
+
+	if (hasError)
+	{
+		std::cout << "Run with --help to list the options." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "ticks=" << ticks << " warmup=" << warmupTicks << " tick_us=" << tickMicroseconds
+		<< " avx2=" << (MovementKernel::isAvx2Supported() ? "true" : "false") << std::endl;
+
+	for (std::size_t i = 0; i < enemyCounts.size(); i++)
+	{
+		for (std::size_t j = 0; j < projectileCounts.size(); j++)
+		{
+			BenchmarkResult result = measure(enemyCounts[i], projectileCounts[j]);
+			std::cout << "enemies=" << result.enemyCount
+				<< " projectiles=" << result.projectileCount
+				<< " movement_ns=" << result.movementNanoseconds
+				<< " collision_ns=" << result.collisionNanoseconds
+				<< " destruction_ns=" << result.destructionNanoseconds
+				<< " spawning_ns=" << result.spawningNanoseconds
+				<< " tick_ns=" << result.tickNanoseconds
+				<< " destroyed_per_tick=" << result.destroyedPerTick
+				<< " spawned_per_tick=" << result.spawnedPerTick << std::endl;
+		}
+	}
+
+	for (std::size_t i = 0; i < boxCounts.size(); i++)
+	{
+		NarrowPhaseResult result = measureNarrowPhase(boxCounts[i]);
+		std::cout << "boxes=" << result.boxCount
+			<< " copying_ns=" << result.copyingNanoseconds
+			<< " pairwise_ns=" << result.pairwiseNanoseconds
+			<< " batched_ns=" << result.batchedNanoseconds
+			<< " hits=" << result.hits << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+BenchmarkResult SwarmBenchmark::measure(unsigned int enemyCount, unsigned int projectileCount)
+{
+	SwarmSimulation simulation(videoMode, false, nullptr, nullptr, nullptr, seed);
+	simulation.setThreadCount(threadCount);
+	simulation.timeElapsed = tickMicroseconds;
+	std::size_t nextTarget = 0;
+	keepEnemies(simulation, enemyCount);
+	keepProjectiles(simulation, projectileCount, nextTarget);
+
+	std::vector<long long> movement;
+	std::vector<long long> collision;
+	std::vector<long long> destruction;
+	std::vector<long long> spawning;
+	std::vector<long long> total;
+	std::size_t destroyedCount = 0;
+	std::size_t spawnedCount = 0;
+	for (unsigned int tick = 0; tick < warmupTicks + ticks; tick++)
+	{
+		simulation.health = 100;
+		simulation.isGameOver = false;
+		simulation.enemies.storePreviousPositions();
+
+		std::size_t aliveBefore = simulation.enemies.size();
+		BenchmarkClock::time_point start = BenchmarkClock::now();
+		simulation.destroyEnemies();
+		BenchmarkClock::time_point destroyed = BenchmarkClock::now();
+		std::size_t aliveAfter = simulation.enemies.size();
+		// The wave spawner alone rarely adds anything; the top-up back to the requested count is what replaces the destroyed enemies.
+		simulation.spawnEnemies();
+		keepEnemies(simulation, enemyCount);
+		BenchmarkClock::time_point spawned = BenchmarkClock::now();
+		std::size_t aliveAfterSpawning = simulation.enemies.size();
+
+		BenchmarkClock::time_point moveStart = BenchmarkClock::now();
+		simulation.moveEnemies();
+		simulation.moveProjectiles();
+		BenchmarkClock::time_point moved = BenchmarkClock::now();
+		simulation.checkForCollisions();
+		simulation.cullProjectiles();
+		BenchmarkClock::time_point collided = BenchmarkClock::now();
+
+		keepProjectiles(simulation, projectileCount, nextTarget);
+
+		if (tick < warmupTicks) continue;
+
+		destroyedCount += aliveBefore - aliveAfter;
+		spawnedCount += aliveAfterSpawning - aliveAfter;
+		destruction.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(destroyed - start).count());
+		spawning.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(spawned - destroyed).count());
+		movement.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(moved - moveStart).count());
+		collision.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(collided - moved).count());
+		total.push_back(destruction.back() + spawning.back() + movement.back() + collision.back());
+	}
+
+	BenchmarkResult result;
+	result.enemyCount = enemyCount;
+	result.projectileCount = projectileCount;
+	result.movementNanoseconds = getMedian(movement);
+	result.collisionNanoseconds = getMedian(collision);
+	result.destructionNanoseconds = getMedian(destruction);
+	result.spawningNanoseconds = getMedian(spawning);
+	result.tickNanoseconds = getMedian(total);
+	result.destroyedPerTick = ticks > 0 ? (double)destroyedCount / ticks : 0.0;
+	result.spawnedPerTick = ticks > 0 ? (double)spawnedCount / ticks : 0.0;
+	return result;
+}
+
+NarrowPhaseResult SwarmBenchmark::measureNarrowPhase(unsigned int boxCount)
+{
+	RandomStream random(seed, RandomSubsystem::Spawning);
+	sf::Vector2f dimensions = EnemyStore::getBaseDimensions(videoMode);
+	std::vector<AABB> boxes;
+	std::vector<MoveableRectangle> rectangles;
+	for (unsigned int i = 0; i < boxCount; i++)
+	{
+		sf::Vector2f center(random.nextFloat() * videoMode.width, random.nextFloat() * videoMode.height);
+		boxes.push_back(AABB::fromCenter(center, dimensions));
+		rectangles.push_back(MoveableRectangle(dimensions));
+		rectangles.back().moveTo(center.x, center.y);
+	}
+
+	sf::Vector2f screenCenter((float)videoMode.width / 2.0f, (float)videoMode.height / 2.0f);
+	sf::Vector2f otherDimensions((float)videoMode.width / 2.0f, (float)videoMode.height / 2.0f);
+	AABB other = AABB::fromCenter(screenCenter, otherDimensions);
+	MoveableRectangle otherRectangle(otherDimensions);
+	otherRectangle.moveTo(screenCenter.x, screenCenter.y);
+
+	std::vector<sf::Uint64> mask;
+	std::vector<long long> copying;
+	std::vector<long long> pairwise;
+	std::vector<long long> batched;
+	unsigned int copyingHits = 0;
+	unsigned int pairwiseHits = 0;
+	unsigned int batchedHits = 0;
+	for (unsigned int repetition = 0; repetition < warmupTicks + ticks; repetition++)
+	{
+		copyingHits = 0;
+		pairwiseHits = 0;
+		batchedHits = 0;
+
+		BenchmarkClock::time_point start = BenchmarkClock::now();
+		for (std::size_t i = 0; i < rectangles.size(); i++)
+		{
+			if (didCollideByCopy(rectangles[i], otherRectangle)) copyingHits++;
+		}
+		BenchmarkClock::time_point copied = BenchmarkClock::now();
+		for (std::size_t i = 0; i < boxes.size(); i++)
+		{
+			if (boxes[i].overlaps(other)) pairwiseHits++;
+		}
+		BenchmarkClock::time_point tested = BenchmarkClock::now();
+		AABB::overlaps(boxes.data(), boxes.size(), other, mask);
+		for (std::size_t word = 0; word < mask.size(); word++)
+		{
+			for (sf::Uint64 bits = mask[word]; bits != 0; bits &= bits - 1)
+			{
+				batchedHits++;
+			}
+		}
+		BenchmarkClock::time_point batchTested = BenchmarkClock::now();
+
+		if (repetition < warmupTicks) continue;
+
+		copying.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(copied - start).count());
+		pairwise.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(tested - copied).count());
+		batched.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(batchTested - tested).count());
+	}
+
+	if (copyingHits != pairwiseHits || pairwiseHits != batchedHits)
+	{
+		std::cout << "Failed to agree on the narrow phase hits of " << boxCount << " boxes." << std::endl;
+	}
+
+	NarrowPhaseResult result;
+	result.boxCount = boxCount;
+	result.copyingNanoseconds = getMedian(copying);
+	result.pairwiseNanoseconds = getMedian(pairwise);
+	result.batchedNanoseconds = getMedian(batched);
+	result.hits = batchedHits;
+	return result;
+}
+
+void SwarmBenchmark::printUsage()
+{
+	std::cout << "Options:" << std::endl
+		<< "  --ticks N             Ticks measured for each population (default 200)" << std::endl
+		<< "  --warmup N            Ticks run before measuring (default 120)" << std::endl
+		<< "  --tick-us N           Simulated microseconds per tick (default 16667)" << std::endl
+		<< "  --width N             Screen width the simulation is laid out for (default 1920)" << std::endl
+		<< "  --height N            Screen height the simulation is laid out for (default 1080)" << std::endl
+		<< "  --enemies N,N,...     Enemy counts to benchmark (default 1000,10000,100000)" << std::endl
+		<< "  --projectiles N,N,... Projectile counts to benchmark (default 100,1000,10000)" << std::endl
+		<< "  --boxes N,N,...       Box counts to benchmark the narrow phase with (default 64,4096,65536)" << std::endl
+		<< "  --seed N              Seed of the random streams (default 1)" << std::endl
+		<< "  --threads N           Threads the simulation steps on (default 1)" << std::endl
+		<< "  --help                Print these options" << std::endl;
+}
+
+void SwarmBenchmark::keepEnemies(SwarmSimulation& simulation, unsigned int enemyCount)
+{
+	EnemyStore& enemies = simulation.enemies;
+	while (enemies.size() < enemyCount)
+	{
+		simulation.generateEnemy();
+	}
+
+	while (enemies.size() > enemyCount)
+	{
+		enemies.destroy(enemies.getHandle(enemies.size() - 1));
+	}
+}
+
+void SwarmBenchmark::keepProjectiles(SwarmSimulation& simulation, unsigned int projectileCount, std::size_t& nextTarget)
+{
+	EnemyStore& enemies = simulation.enemies;
+	if (enemies.empty()) return;
+
+	while (simulation.projectiles.size() < projectileCount && simulation.projectiles.size() < simulation.projectiles.capacity())
+	{
+		nextTarget = (nextTarget + targetStride) % enemies.size();
+		simulation.fireProjectileAt(enemies.getCenterCoordinates(nextTarget));
+	}
+
+	while (simulation.projectiles.size() > projectileCount)
+	{
+		simulation.projectiles.release(simulation.projectiles.size() - 1);
+	}
+}
+
+bool SwarmBenchmark::didCollideByCopy(const MoveableRectangle& component, MoveableRectangle otherComponent)
+{
+	return didComponentsCollideByCopy(component, otherComponent);
+}
+
+bool SwarmBenchmark::didComponentsCollideByCopy(MoveableRectangle componentA, MoveableRectangle componentB)
+{
+	return doOverlapOnXByCopy(componentA, componentB) && doOverlapOnYByCopy(componentA, componentB);
+}
+
+bool SwarmBenchmark::doOverlapOnXByCopy(MoveableRectangle componentA, MoveableRectangle componentB)
+{
+	return componentA.getBounds().right >= componentB.getBounds().left && componentA.getBounds().left <= componentB.getBounds().right;
+}
+
+bool SwarmBenchmark::doOverlapOnYByCopy(MoveableRectangle componentA, MoveableRectangle componentB)
+{
+	return componentA.getBounds().bottom >= componentB.getBounds().top && componentA.getBounds().top <= componentB.getBounds().bottom;
+}
+
+long long SwarmBenchmark::getMedian(std::vector<long long>& samples)
+{
+	if (samples.empty()) return 0;
+
+	std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+	return samples[samples.size() / 2];
+}
+
+std::vector<unsigned int> SwarmBenchmark::parseCounts(const std::string& value)
+{
+	std::vector<unsigned int> counts;
+	std::istringstream items(value);
+	std::string item;
+	while (std::getline(items, item, ','))
+	{
+		counts.push_back(std::stoul(item));
+	}
+
+	return counts;
+}
@@ -0,0 +1,262 @@
+#ifndef SWARM_BENCHMARK_H
+#define SWARM_BENCHMARK_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include "SwarmSimulation.h"
+
+/// <summary>
+/// The time each phase of a simulation step took for one benchmarked population, as the median over the measured ticks.
+/// </summary>
+struct BenchmarkResult
+{
+	/// <summary>
+	/// The number of enemies kept alive during the benchmark.
+	/// </summary>
+	unsigned int enemyCount;
+
+	/// <summary>
+	/// The number of projectiles kept in flight during the benchmark.
+	/// </summary>
+	unsigned int projectileCount;
+
+	/// <summary>
+	/// The median time in nanoseconds to move the enemies and projectiles.
+	/// </summary>
+	long long movementNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds to rebuild the broad phase grid, check every collision and cull spent projectiles.
+	/// </summary>
+	long long collisionNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds to destroy the dead enemies.
+	/// </summary>
+	long long destructionNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds to spawn the replacement enemies, both from the wave spawner and the top-up back to the enemy count.
+	/// </summary>
+	long long spawningNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds of the four phases together.
+	/// </summary>
+	long long tickNanoseconds;
+
+	/// <summary>
+	/// The mean number of dead enemies destroyed per measured tick. Each one is replaced by the spawning phase.
+	/// </summary>
+	double destroyedPerTick;
+
+	/// <summary>
+	/// The mean number of enemies the spawning phase added per measured tick.
+	/// </summary>
+	double spawnedPerTick;
+};
+
+/// <summary>
+/// The time each narrow phase path took to test a list of boxes against one box, as the median over the measured repetitions.
+/// </summary>
+struct NarrowPhaseResult
+{
+	/// <summary>
+	/// The number of boxes tested.
+	/// </summary>
+	unsigned int boxCount;
+
+	/// <summary>
+	/// The median time in nanoseconds to test every box by copying both rectangles into each test, as collisions used to be checked.
+	/// </summary>
+	long long copyingNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds to test every box one at a time with AABB::overlaps.
+	/// </summary>
+	long long pairwiseNanoseconds;
+
+	/// <summary>
+	/// The median time in nanoseconds to test every box at once with the batched AABB::overlaps.
+	/// </summary>
+	long long batchedNanoseconds;
+
+	/// <summary>
+	/// The number of boxes that overlapped. The same for every path.
+	/// </summary>
+	unsigned int hits;
+};
+
+/// <summary>
+/// Runs the swarm simulation step by step at fixed enemy and projectile counts and times movement, collision, destruction and spawning
+/// separately. The spawning phase tops the enemies back up to the requested count; between ticks, outside the timed phases, the
+/// projectiles are topped up or trimmed back and the player's health is restored, so every tick of a run does comparable work. Reports the median of each phase as key=value lines.
+/// </summary>
+class SwarmBenchmark
+{
+public:
+	/// <summary>
+	/// Parses the command line options. Supported options are --ticks N, --warmup N, --tick-us N, --width N, --height N, --seed N,
+	/// --threads N, and --enemies, --projectiles and --boxes, which each take a comma separated list of counts. Every enemy count is run
+	/// with every projectile count, then the narrow phase is run for every box count. --help prints the options instead of running.
+	/// </summary>
+	/// <param name="argc">The number of arguments.</param>
+	/// <param name="argv">The arguments, starting with the program name.</param>
+	SwarmBenchmark(int argc, char* argv[]);
+
+	~SwarmBenchmark();
+
+	/// <summary>
+	/// Runs every combination of enemy and projectile counts, then every box count, and prints one line of results for each.
+	/// </summary>
+	/// <returns>EXIT_SUCCESS, or EXIT_FAILURE if the options could not be parsed.</returns>
+	int run();
+
+	/// <summary>
+	/// Benchmarks one population.
+	/// </summary>
+	/// <param name="enemyCount">The number of enemies to keep alive.</param>
+	/// <param name="projectileCount">The number of projectiles to keep in flight.</param>
+	/// <returns>The median time of each phase.</returns>
+	BenchmarkResult measure(unsigned int enemyCount, unsigned int projectileCount);
+
+	/// <summary>
+	/// Benchmarks the narrow phase paths on the provided number of enemy-sized boxes scattered over the screen, tested against a box
+	/// covering the middle of the screen.
+	/// </summary>
+	/// <param name="boxCount">The number of boxes to test.</param>
+	/// <returns>The median time of each path.</returns>
+	NarrowPhaseResult measureNarrowPhase(unsigned int boxCount);
+
+	/// <summary>
+	/// Prints the supported options to standard output.
+	/// </summary>
+	static void printUsage();
+
+private:
+	/// <summary>
+	/// The number of ticks measured for each population.
+	/// </summary>
+	unsigned int ticks;
+
+	/// <summary>
+	/// The number of ticks run before measuring so the population reaches a steady state. Should cover the death animation, so enemies
+	/// hit during the warmup are being destroyed once measuring starts.
+	/// </summary>
+	unsigned int warmupTicks;
+
+	/// <summary>
+	/// The simulated time of each tick in microseconds.
+	/// </summary>
+	sf::Int64 tickMicroseconds;
+
+	/// <summary>
+	/// The video mode the simulation is laid out for.
+	/// </summary>
+	sf::VideoMode videoMode;
+
+	/// <summary>
+	/// The enemy counts to benchmark.
+	/// </summary>
+	std::vector<unsigned int> enemyCounts;
+
+	/// <summary>
+	/// The projectile counts to benchmark.
+	/// </summary>
+	std::vector<unsigned int> projectileCounts;
+
+	/// <summary>
+	/// The box counts to benchmark the narrow phase with.
+	/// </summary>
+	std::vector<unsigned int> boxCounts;
+
+	/// <summary>
+	/// The seed of the simulation's random streams. Every population is run with the same seed.
+	/// </summary>
+	sf::Uint64 seed;
+
+	/// <summary>
+	/// The number of threads the simulation steps on.
+	/// </summary>
+	unsigned int threadCount;
+
+	/// <summary>
+	/// Is true if an option could not be parsed.
+	/// </summary>
+	bool hasError;
+
+	/// <summary>
+	/// Is true if --help was passed, in which case run prints the options instead of benchmarking.
+	/// </summary>
+	bool isShowingHelp;
+
+	/// <summary>
+	/// Spawns or destroys enemies until the provided simulation holds the provided number of enemies.
+	/// </summary>
+	/// <param name="simulation">The simulation to change.</param>
+	/// <param name="enemyCount">The number of enemies to keep.</param>
+	static void keepEnemies(SwarmSimulation& simulation, unsigned int enemyCount);
+
+	/// <summary>
+	/// Fires projectiles at enemies until the provided simulation holds the provided number of projectiles, or its projectile pool is full.
+	/// </summary>
+	/// <param name="simulation">The simulation to change.</param>
+	/// <param name="projectileCount">The number of projectiles to keep.</param>
+	/// <param name="nextTarget">The index of the next enemy to fire at. Advanced by each projectile fired.</param>
+	static void keepProjectiles(SwarmSimulation& simulation, unsigned int projectileCount, std::size_t& nextTarget);
+
+	/// <summary>
+	/// Tests two rectangles the way MoveableRectangle::didCollideWithOtherComponent did before AABB: the other rectangle is taken by value
+	/// and handed on by value to didComponentsCollideByCopy, which hands both on by value to the test of each axis. Every test copies seven
+	/// rectangles and their shapes.
+	/// </summary>
+	/// <param name="component">The rectangle testing for a collision.</param>
+	/// <param name="otherComponent">The other rectangle.</param>
+	/// <returns>True if the rectangles overlap or touch.</returns>
+	static bool didCollideByCopy(const MoveableRectangle& component, MoveableRectangle otherComponent);
+
+	/// <summary>
+	/// The old MoveableRectangle::didComponentsCollide.
+	/// </summary>
+	/// <param name="componentA">The first rectangle.</param>
+	/// <param name="componentB">The second rectangle.</param>
+	/// <returns>True if the rectangles overlap or touch.</returns>
+	static bool didComponentsCollideByCopy(MoveableRectangle componentA, MoveableRectangle componentB);
+
+	/// <summary>
+	/// The old MoveableRectangle::doOverlapOnX.
+	/// </summary>
+	/// <param name="componentA">The first rectangle.</param>
+	/// <param name="componentB">The second rectangle.</param>
+	/// <returns>True if the rectangles overlap or touch on the x-axis.</returns>
+	static bool doOverlapOnXByCopy(MoveableRectangle componentA, MoveableRectangle componentB);
+
+	/// <summary>
+	/// The old MoveableRectangle::doOverlapOnY.
+	/// </summary>
+	/// <param name="componentA">The first rectangle.</param>
+	/// <param name="componentB">The second rectangle.</param>
+	/// <returns>True if the rectangles overlap or touch on the y-axis.</returns>
+	static bool doOverlapOnYByCopy(MoveableRectangle componentA, MoveableRectangle componentB);
+
+	/// <summary>
+	/// Gets the median of the provided samples, reordering them.
+	/// </summary>
+	/// <param name="samples">The samples.</param>
+	/// <returns>The median sample, or 0 if there are none.</returns>
+	static long long getMedian(std::vector<long long>& samples);
+
+	/// <summary>
+	/// Parses a comma separated list of counts.
+	/// </summary>
+	/// <param name="value">The list to parse.</param>
+	/// <returns>The parsed counts.</returns>
+	static std::vector<unsigned int> parseCounts(const std::string& value);
+};
+
+#endif // !SWARM_BENCHMARK_H
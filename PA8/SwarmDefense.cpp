@@ -1,10 +1,28 @@
 #include "SwarmDefense.h"
 #include <iostream>
 
-const static float enemyVelocity = 0.0001f;
 static const std::string scorePrefix = "Score: ";
 static const std::string healthPrefix = "Health: ";
 static const std::string coinsPrefix = "Coins: ";
+static const int ghostFrameCount = 14;
+
+// The name of the image of each ghost animation frame in the sprite atlas, in GhostAnimation order.
+static const std::string ghostFrameNames[ghostFrameCount] = {
+	"ghostTailUp",
+	"ghostTailDown",
+	"ghostDeath1",
+	"ghostDeath2",
+	"ghostDeath3",
+	"ghostDeath4",
+	"ghostDeath5",
+	"ghostAttack1",
+	"ghostAttack2",
+	"ghostAttack3",
+	"ghostAttack4",
+	"ghostAttack5",
+	"ghostAttack6",
+	"ghostAttack7"
+};
 
 
 SwarmDefense::SwarmDefense(
@@ -12,124 +30,47 @@ SwarmDefense::SwarmDefense(
 	bool mp,
 	ScreenManager* manager,
 	void(ScreenManager::* sendEnemiesCallback)(sf::Uint16 numberOfEnemies),
-	sf::Uint16(ScreenManager::* getEnemiesCallback)()
+	sf::Uint16(ScreenManager::* getEnemiesCallback)(),
+	sf::Int64 tickLength
 	)
 {
 	isShopModalDisplayed = false;
+	tickMicroseconds = tickLength;
 	videoMode = vm;
-	if (!castleTexture.loadFromFile("assets/castle.png"))
-	{
-		std::cout << "Failed to load castle texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::TailUp].loadFromFile("assets/ghostTailUp.png"))
-	{
-		std::cout << "Failed to load ghostTailUp texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::TailDown].loadFromFile("assets/ghostTailDown.png"))
-	{
-		std::cout << "Failed to load ghostTailDown texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Death1].loadFromFile("assets/ghostDeath1.png"))
-	{
-		std::cout << "Failed to load ghostDeath1 texture." << std::endl;
-	}
+	ResourceCache& cache = ResourceCache::getInstance();
+	spriteAtlas = cache.getTextureAtlas("assets/atlases.txt", "sprites");
 
-	if (!ghostTextures[(int)GhostAnimation::Death2].loadFromFile("assets/ghostDeath2.png"))
+	for (int i = 0; i < ghostFrameCount; i++)
 	{
-		std::cout << "Failed to load ghostDeath2 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Death3].loadFromFile("assets/ghostDeath3.png"))
-	{
-		std::cout << "Failed to load ghostDeath3 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Death4].loadFromFile("assets/ghostDeath4.png"))
-	{
-		std::cout << "Failed to load ghostDeath4 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Death5].loadFromFile("assets/ghostDeath5.png"))
-	{
-		std::cout << "Failed to load ghostDeath5 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack1].loadFromFile("assets/ghostAttack1.png"))
-	{
-		std::cout << "Failed to load ghostAttack1 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack2].loadFromFile("assets/ghostAttack2.png"))
-	{
-		std::cout << "Failed to load ghostAttack2 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack3].loadFromFile("assets/ghostAttack3.png"))
-	{
-		std::cout << "Failed to load ghostAttack3 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack4].loadFromFile("assets/ghostAttack4.png"))
-	{
-		std::cout << "Failed to load ghostAttack4 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack5].loadFromFile("assets/ghostAttack5.png"))
-	{
-		std::cout << "Failed to load ghostAttack5 texture." << std::endl;
-	}
-
-	if (!ghostTextures[(int)GhostAnimation::Attack6].loadFromFile("assets/ghostAttack6.png"))
-	{
-		std::cout << "Failed to load ghostAttack6 texture." << std::endl;
+		if (!spriteAtlas->getRect(ghostFrameNames[i], ghostFrames[i]))
+		{
+			std::cout << "Failed to find " << ghostFrameNames[i] << " in sprite atlas." << std::endl;
+		}
 	}
 
-	if (!ghostTextures[(int)GhostAnimation::Attack7].loadFromFile("assets/ghostAttack7.png"))
+	simulation = new SwarmSimulation(vm, mp, manager, sendEnemiesCallback, getEnemiesCallback, RandomStream::makeSeed());
+	simulation->setThreadCount(std::thread::hardware_concurrency());
+	sf::IntRect castleRect;
+	if (!spriteAtlas->getRect("castle", castleRect))
 	{
-		std::cout << "Failed to load ghostAttack7 texture." << std::endl;
+		std::cout << "Failed to find castle in sprite atlas." << std::endl;
 	}
-
-	playerBase = new MoveableRectangle(sf::Vector2f(vm.height*0.1f, vm.height * 0.1f), &castleTexture);
-	playerBase->centerHorizontal(videoMode);
-	playerBase->centerVertical(videoMode);
+	simulation->getPlayerBase()->setTexture(&spriteAtlas->getTexture(), castleRect);
 	shouldGoBackToMainMenu = false;
-	currentEnemyId = INT16_MIN;
-	generateEnemy();
 	
-	displayedScore = new TextComponent("Leander.ttf", scorePrefix + std::to_string(score), 50, 1);
-	displayedScore->snapToLeft();
-	displayedScore->setColor(sf::Color::Green);
+	displayedScore = new HudCounter("Leander.ttf", scorePrefix, simulation->getScore(), 50, 1, sf::Color::Green);
 	
-	health = 100;
-
-	displayedHealth = new TextComponent("Leander.ttf", healthPrefix + std::to_string(health), 50, 1);
-	displayedHealth->snapToLeft();
+	displayedHealth = new HudCounter("Leander.ttf", healthPrefix, simulation->getHealth(), 50, 1, sf::Color::Green);
 	displayedHealth->snapToVertical(videoMode, 10, 2);
-	displayedHealth->setColor(sf::Color::Green);
 
-	displayedCoins = new TextComponent("Leander.ttf", coinsPrefix + std::to_string(coins), 50, 1);
-	displayedCoins->snapToLeft();
+	displayedCoins = new HudCounter("Leander.ttf", coinsPrefix, simulation->getCoins(), 50, 1, sf::Color::Green);
 	displayedCoins->snapToVertical(videoMode, 10, 3);
-	displayedCoins->setColor(sf::Color::Green);
-
-	isGameOver = false;
 
 	//Sounds
 
-	if (!Hit.loadFromFile("assets/Hit.wav")) {
-		std::cout << "Hit sound error";
-	}
-		
-	if (!Explosion.loadFromFile("assets/Explosion.wav")) {
-		std::cout << "Exp sound error";
-	}
-
-	if (!Lose.loadFromFile("assets/Lose.wav")) {
-		std::cout << "Lose sound error";
-	}
+	Hit = cache.getSoundBuffer("assets/Hit.wav");
+	Explosion = cache.getSoundBuffer("assets/Explosion.wav");
+	Lose = cache.getSoundBuffer("assets/Lose.wav");
 
 	////Music
 	if (!music.openFromFile("assets/HHMega.ogg")) {
@@ -139,43 +80,52 @@ SwarmDefense::SwarmDefense(
 	music.play();
 	
 
-	isMultiplayer = mp;
-	parentManager = manager;
-	onSendEnemies = sendEnemiesCallback;
-	onGetEnemies = getEnemiesCallback;
-	enemiesCollided = 0;
-	unitOfDistance = hypotf((float)videoMode.height, (float)videoMode.width)*0.01f;
 	shopModal = new ShopModal(videoMode, this, &SwarmDefense::purchaseWeapon, &SwarmDefense::closeShopModal);
-	clock.restart();
+
+	hitsHeard = 0;
+	explosionsHeard = 0;
+	purchasesSettled = 0;
+	simulationThread = new SimulationThread(*simulation, tickMicroseconds);
+	simulationThread->start();
 }
 
 SwarmDefense::~SwarmDefense()
 {
-	delete playerBase;
-	playerBase = nullptr;
+	delete simulationThread;
+	simulationThread = nullptr;
+	delete simulation;
+	simulation = nullptr;
 	delete displayedScore;
 	displayedScore = nullptr;
+	delete displayedHealth;
+	displayedHealth = nullptr;
 	delete displayedCoins;
 	displayedCoins = nullptr;
 	delete shopModal;
 	shopModal = nullptr;
 }
 
+void SwarmDefense::requestAssets(AssetLoader& loader)
+{
+	loader.requestTextureAtlas("assets/atlases.txt", "sprites");
+	loader.requestSoundBuffer("assets/Hit.wav");
+	loader.requestSoundBuffer("assets/Explosion.wav");
+	loader.requestSoundBuffer("assets/Lose.wav");
+}
+
 void SwarmDefense::drawTo(sf::RenderWindow& window)
 {
-	std::string newScore = std::to_string(score);
-	std::string newHealth = std::to_string(health);
-	std::string newCoins = std::to_string(coins);
-
-	displayedScore->setText(scorePrefix + newScore);
-	displayedHealth->setText(healthPrefix + newHealth);
-	displayedCoins->setText(coinsPrefix + newCoins);
-	displayedScore->snapToLeft();
-	displayedHealth->snapToLeft();
-	displayedCoins->snapToLeft();
-
-	playerBase->drawTo(window);
-	if (!isGameOver)
+	simulationThread->acquireSnapshot();
+	const RenderSnapshot& snapshot = simulationThread->getSnapshot();
+	float snapshotInterpolation = simulationThread->getInterpolation(snapshot);
+
+	displayedScore->setValue(snapshot.score);
+	displayedHealth->setValue(snapshot.health);
+	displayedCoins->setValue(snapshot.coins);
+
+	// The base never moves, so drawing it while the simulation thread reads its bounds is safe.
+	simulation->getPlayerBase()->drawTo(window);
+	if (!snapshot.isGameOver)
 	{
 		displayedScore->drawTo(window);
 		displayedHealth->drawTo(window);
@@ -184,21 +134,35 @@ void SwarmDefense::drawTo(sf::RenderWindow& window)
 	
 
 	//Draw projectiles
-	for (std::list<Projectile>::iterator i = projectiles.begin(); i != projectiles.end(); i++) {
-		(*i).drawTo(window);
-}
+	projectileBatch.clear();
+	for (const ProjectileSnapshot& projectile : snapshot.projectiles) {
+		projectileBatch.add(
+			projectile.previousPosition + (projectile.position - projectile.previousPosition) * snapshotInterpolation,
+			projectile.size,
+			sf::Color::White
+			);
+	}
+	projectileBatch.drawTo(window, nullptr);
 
-	for (std::list<Enemy>::iterator i = enemies.begin(); i != enemies.end(); ++i)
+	ghostBatch.clear();
+	for (const GhostSnapshot& ghost : snapshot.ghosts)
 	{
-		(*i).drawTo(window);
+		ghostBatch.add(
+			ghost.previousPosition + (ghost.position - ghost.previousPosition) * snapshotInterpolation,
+			ghost.size,
+			ghost.origin,
+			ghostFrames[(int)ghost.animation],
+			ghost.isMirrored
+			);
 	}
+	ghostBatch.drawTo(window, &spriteAtlas->getTexture());
 
 	if (isShopModalDisplayed)
 	{
 		shopModal->drawTo(window);
 	}
 
-	if (isGameOver)
+	if (snapshot.isGameOver)
 	{
 		displayedScore->drawTo(window);
 		displayedHealth->drawTo(window);
@@ -238,7 +202,7 @@ void SwarmDefense::handleEvents(sf::RenderWindow& window)
 			shouldGoBackToMainMenu = true;
 		}
 
-		if (isGameOver) { 
+		if (simulationThread->getSnapshot().isGameOver) { 
 			return;
 		}
 
@@ -251,8 +215,7 @@ void SwarmDefense::handleEvents(sf::RenderWindow& window)
 				float xpos = sf::Mouse::getPosition(window).x;
 				float ypos = sf::Mouse::getPosition(window).y;
 
-				Projectile newProj(videoMode, 0, xpos, ypos);
-				projectiles.push_back(newProj);
+				simulationThread->fireProjectileAt(sf::Vector2f(xpos, ypos));
 			}
 		}
 
@@ -265,237 +228,49 @@ void SwarmDefense::handleEvents(sf::RenderWindow& window)
 
 void SwarmDefense::updateState()
 {
-	if (isGameOver) { 
-		if (!isGameOverMusic) {
-			isGameOverMusic = true;
-			music.stop();
-			sound.setBuffer(Lose);
-			sound.play();
-		}
-		return; 
-	}
-	timeElapsed = clock.restart();
-	
-	destroyEnemies();
-
-	for (std::list<Enemy>::iterator i = enemies.begin(); i != enemies.end(); ++i)
-	{
-		if (!(*i).getIsDying())
-		{
-			if (!(*i).getIsAttacking())
-			{
-				(*i).shiftTowards((float)videoMode.width / 2.0f, (float)videoMode.height / 2.0f, distanceTravelled());
-			}
-
-			if ((*i).getDidAttack())
-
-			{
-				health = health <= 1 ? 0 : health-1;
-				enemiesCollided++;
-				(*i).die();
-
-				//Play explosion sound
-				sound.setBuffer(Explosion);
-				sound.play();
-
-				if (health == 0)
-				{
-					isGameOver = true;
-				}
-			}
-		}
-
-		if ((*i).getIsDead())
-		{
-			enemiesToDestroy.push((*i).getId());
-		}
-
-		(*i).setTimeElapsed(timeElapsed.asMicroseconds());
-	}
-
-	for (std::list<Projectile>::iterator i = projectiles.begin(); i != projectiles.end(); i++) {
-		if (!(*i).getHasHit())
-		{
-			(*i).shiftTowards((*i).getxDest(), (*i).getyDest(), distanceTravelled() * 5);
-		}
-	}
-
-	for (std::list<Weapon>::iterator i = weapons.begin(); i != weapons.end(); ++i)
-	{
-		(*i).setTimeElapsed(timeElapsed.asMicroseconds());
-	}
-
-	checkForCollisions();
-}
-
-void SwarmDefense::generateEnemy()
-{
-	Enemy newEnemy(videoMode, currentEnemyId++, ghostTextures);
-	try
-	{
-		enemies.push_front(newEnemy);
-	}
-	catch (const std::exception& ex)
-	{
-		std::cout << "Failed to generate enemy: " << ex.what() << std::endl;
-	}
-
-}
-
-
-
-void SwarmDefense::destroyEnemies()
-{
-	sf::Uint16 enemiesDestroyed = 0;
-	while (!enemiesToDestroy.empty())
-	{
-		
-
-		if (enemies.empty())
-		{
-			try
-			{
-				enemiesToDestroy.pop();
-			}
-			catch (const std::exception& ex)
-			{
-				std::cout << "Error during pop when 'enemies' is empty: " << ex.what() << std::endl;
-			}
-			
-			continue;
-		}
-
-		int idToDelete = enemiesToDestroy.front();
-		std::list<Enemy>::iterator itemToDelete = enemies.begin();
-		for (std::list<Enemy>::iterator i = enemies.begin(); i != enemies.end(); ++i)
-		{
-			if ((*i).getId() == idToDelete)
-			{
-				itemToDelete = i;
-			}
-		}
+	simulationThread->acquireSnapshot();
+	const RenderSnapshot& snapshot = simulationThread->getSnapshot();
 
-		try
-		{
-			enemies.erase(itemToDelete);
-		}
-		catch (const std::exception& ex)
-		{
-			std::cout << "Error during erase of an enemy: " << ex.what() << std::endl;
-		}
-
-		try
-		{
-			enemiesToDestroy.pop();
-		}
-		catch (const std::exception& ex)
-		{
-			std::cout << "Error during pop after erasing enemy: " << ex.what() << std::endl;
-		}
-		
-		enemiesDestroyed++;
-	}
-
-	if (isMultiplayer)
+	if (snapshot.totalExplosions > explosionsHeard)
 	{
-		if (enemiesDestroyed > enemiesCollided)
-		{
-			((*parentManager).*onSendEnemies)(enemiesDestroyed - enemiesCollided);
-		}
-		
-		enemiesCollided += ((*parentManager).*onGetEnemies)();
+		explosionsHeard = snapshot.totalExplosions;
+		//Play explosion sound
+		sound.setBuffer(*Explosion);
+		sound.play();
 	}
-	else
-	{
-		enemiesCollided = enemiesDestroyed;
-	}
-
 
-	for (int i = 0; i < enemiesCollided * 2; i++)
+	if (snapshot.totalHits > hitsHeard)
 	{
-		generateEnemy();
+		hitsHeard = snapshot.totalHits;
+		//Hit sound
+		sound.setBuffer(*Hit);
+		sound.play();
 	}
-	
-	enemiesCollided = 0;
-}
-
-void SwarmDefense::checkForCollisions()
-{
-	for (std::list<Enemy>::iterator i = enemies.begin(); i != enemies.end(); ++i)
-	{
-		if ((*i).didCollideWithOtherComponent(*playerBase))
-		{
-			(*i).attack();
-		}
-
 
+	if (snapshot.isGameOver && !isGameOverMusic) {
+		isGameOverMusic = true;
+		music.stop();
+		sound.setBuffer(*Lose);
+		sound.play();
 	}
-
-	std::list<Projectile>::iterator projectileToDestroy;
-
-	bool didFind = false;
-	
-	do
-	{
-		didFind = false;
-		for (std::list<Projectile>::iterator i = projectiles.begin(); i != projectiles.end(); ++i) {
-			for (std::list<Enemy>::iterator j = enemies.begin(); j != enemies.end(); ++j)
-			{
-				if ((*j).didCollideWithOtherComponent(*i))
-				{
-					didFind = true;
-					projectileToDestroy = i;
-
-					if (!(*j).getIsDying())
-					{
-						score++;
-						coins += 10;
-
-						//Hit sound
-						sound.setBuffer(Hit);
-						sound.play();
-					}
-					(*j).die();
-				}
-
-				if (didFind) break;
-			}
-
-			if (didFind) break;
-		}
-
-		if (didFind)
-		{
-			projectiles.erase(projectileToDestroy);
-		}
-
-	} while (didFind);
-	
-
-}
-
-
-float SwarmDefense::distanceTravelled()
-{
-	return (float)timeElapsed.asMicroseconds() * enemyVelocity;
 }
 
 bool SwarmDefense::purchaseWeapon(unsigned int cost, WeaponType type)
 {
-	if (coins < cost) return false;
-	
-	coins -= cost;
-	Weapon newWeapon(2000000, 1, this, &SwarmDefense::generateProjectiles);
-
-	switch (type)
+	const RenderSnapshot& snapshot = simulationThread->getSnapshot();
+	while (purchasesSettled < snapshot.purchasesApplied && !unappliedPurchaseCosts.empty())
 	{
-	case WeaponType::Basic:
-		weapons.push_back(newWeapon);
-		break;
-	default:
-		break;
+		unappliedPurchaseCosts.pop_front();
+		purchasesSettled++;
 	}
 
+	// The coins in the snapshot do not include purchases still waiting on the simulation thread
+	unsigned int unappliedSpending = 0;
+	for (unsigned int unappliedCost : unappliedPurchaseCosts) unappliedSpending += unappliedCost;
+	if (snapshot.coins < unappliedSpending || snapshot.coins - unappliedSpending < cost) return false;
+
+	simulationThread->purchaseWeapon(cost, type);
+	unappliedPurchaseCosts.push_back(cost);
 	return true;
 }
 
@@ -503,43 +278,3 @@ void SwarmDefense::closeShopModal()
 {
 	isShopModalDisplayed = false;
 }
-
-void SwarmDefense::generateProjectiles(unsigned char count)
-{
-	sf::Vector2f randomEnemyPosition;
-	if (getPositionOfRandomEnemy(randomEnemyPosition))
-	{
-		fireProjectileAt(randomEnemyPosition);
-	}
-}
-
-void SwarmDefense::fireProjectileAt(sf::Vector2f position)
-{
-	Projectile newProj(videoMode, 0, position.x, position.y);
-	projectiles.push_back(newProj);
-}
-
-bool SwarmDefense::getPositionOfRandomEnemy(sf::Vector2f& position)
-{
-	if (enemies.empty())
-	{
-		return false;
-	}
-
-	int numberOfEnemies = enemies.size();
-	std::random_device rdev{};
-	std::default_random_engine randomEngine{ rdev() };
-	std::uniform_int_distribution<int> integerDistrubution{ 0, numberOfEnemies-1 };
-	auto randomEnemyIndex = integerDistrubution(randomEngine);
-	int index = 0;
-	for (std::list<Enemy>::iterator i = enemies.begin(); i != enemies.end(); ++i)
-	{
-		if (index++ == randomEnemyIndex)
-		{
-			position = (*i).getCenterCoordinates();
-			return true;
-		}
-	}
-
-	return false;
-}
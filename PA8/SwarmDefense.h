@@ -4,20 +4,20 @@
 #include "Screen.h"
 #include "MoveableRectangle.h"
 #include "TextComponent.h"
+#include "HudCounter.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <list>
-#include <random>
-#include <queue>
-#include <cmath>
+#include <deque>
 #include <iostream>
-#include <vector>
-#include "Enemy.h"
 #include "GhostAnimation.h"
-#include "Projectile.h"
 #include "ShopModal.h"
 #include "WeaponType.h"
-#include "Weapon.h"
+#include "SwarmSimulation.h"
+#include "SimulationThread.h"
+#include "ResourceCache.h"
+#include "SpriteBatch.h"
+#include "AssetLoader.h"
 
 
 /// <summary>
@@ -39,12 +39,14 @@ public:
 	/// <param name="manager">The parent screen manager that has this screen as a member as well as the callback functions.</param>
 	/// <param name="sendEnemiesCallback">The callback function to send enemies to the player connected on the network.</param>
 	/// <param name="getEnemiesCallback">The callback function to get the enemies sent by the player connected on the network.</param>
+	/// <param name="tickLength">The simulated time in microseconds that each call to updateState advances the game by.</param>
 	SwarmDefense(
 		sf::VideoMode vm,
 		bool mp,
 		ScreenManager* manager,
 		void(ScreenManager::* sendEnemiesCallback)(sf::Uint16 numberOfEnemies),
-		sf::Uint16(ScreenManager::* getEnemiesCallback)()
+		sf::Uint16(ScreenManager::* getEnemiesCallback)(),
+		sf::Int64 tickLength
 		);
 
 	~SwarmDefense();
@@ -79,158 +81,96 @@ public:
 	void handleEvents(sf::RenderWindow& window);
 
 	/// <summary>
-	/// Updates the internal state of this screen.
+	/// Plays the sounds for what happened in the simulation since the last call. The simulation itself is stepped by its own thread.
 	/// </summary>
 	void updateState();
 
-private:
 	/// <summary>
-	/// The ID of the next enemy to be created. Incremented each time an enemy is created.
+	/// Requests every asset this screen uses that is not already cached, so the screen can be constructed without reading files.
 	/// </summary>
-	int currentEnemyId;
+	/// <param name="loader">The loader to request the assets from.</param>
+	static void requestAssets(AssetLoader& loader);
 
+private:
 	/// <summary>
-	/// A pointer to the rectangle containing the user's base.
+	/// The simulation holding the state of the game. This screen only renders it and forwards input to it.
 	/// </summary>
-	MoveableRectangle* playerBase;
+	SwarmSimulation* simulation;
 
 	/// <summary>
-	/// The video mode that will render this screen.
+	/// The thread stepping the simulation. This screen only reads the snapshots it publishes and queues input on it.
 	/// </summary>
-	sf::VideoMode videoMode;
+	SimulationThread* simulationThread;
 
 	/// <summary>
-	/// Is set to true when the user wants to exit the current screen.
+	/// The number of hits in the snapshot the hit sound was last played for.
 	/// </summary>
-	bool shouldGoBackToMainMenu;
+	unsigned long hitsHeard;
 
 	/// <summary>
-	/// A list of pointers to enemies currently alive.
+	/// The number of explosions in the snapshot the explosion sound was last played for.
 	/// </summary>
-	std::list<Enemy> enemies;
+	unsigned long explosionsHeard;
 
 	/// <summary>
-	/// Generates a new enemy and adds it to the list.
+	/// The cost of each purchase queued for the simulation thread that the latest snapshot does not include yet, oldest first.
 	/// </summary>
-	void generateEnemy();
-
-	//Generates a new projectile
-	void generateProj();
-
-
+	std::deque<unsigned int> unappliedPurchaseCosts;
 
 	/// <summary>
-	/// A queue containing the IDs of the enemies to be destroyed.
+	/// The number of queued purchases that have been removed from unappliedPurchaseCosts because a snapshot included them.
 	/// </summary>
-	std::queue<int> enemiesToDestroy;
+	unsigned long purchasesSettled;
 
 	/// <summary>
-	/// The number of enemies that have collided with the player's base.
+	/// The video mode that will render this screen.
 	/// </summary>
-	int enemiesCollided;
-
-
-	//The Projectiles!
-
-	//List of all projectiles currently in use
-	std::list<Projectile> projectiles;
+	sf::VideoMode videoMode;
 
+	/// <summary>
+	/// Is set to true when the user wants to exit the current screen.
+	/// </summary>
+	bool shouldGoBackToMainMenu;
 
 	/// <summary>
 	/// A pointer to the text component that displays the score.
 	/// </summary>
-	TextComponent* displayedScore;
+	HudCounter* displayedScore;
 
 	/// <summary>
 	/// A pointer to the text component that displays the player's health.
 	/// </summary>
-	TextComponent* displayedHealth;
+	HudCounter* displayedHealth;
 
 	/// <summary>
 	/// A pointer to the text component that displays the coins earned by the user.
 	/// </summary>
-	TextComponent* displayedCoins;
-
-	/// <summary>
-	/// The player's current score.
-	/// </summary>
-	unsigned int score;
-
-	/// <summary>
-	/// The player's current coins.
-	/// </summary>
-	unsigned int coins;
+	HudCounter* displayedCoins;
 
 	/// <summary>
-	/// The player's current health.
+	/// The simulated time in microseconds of each tick, so movement does not depend on the frame rate.
 	/// </summary>
-	unsigned short int health;
+	sf::Int64 tickMicroseconds;
 
 	/// <summary>
-	/// Destroy all enemies in the queue.
+	/// The atlas holding the castle image and the images for the different ghost frames.
 	/// </summary>
-	void destroyEnemies();
+	std::shared_ptr<const TextureAtlas> spriteAtlas;
 
 	/// <summary>
-	/// Check for any collisions between the enemies and the player's base.
+	/// The rectangle of the sprite atlas holding each ghost frame, indexed by GhostAnimation.
 	/// </summary>
-	void checkForCollisions();
+	sf::IntRect ghostFrames[14];
 
 	/// <summary>
-	/// Is true when the player loses all of their health.
+	/// The batch every ghost is added to so they are drawn with a single draw call.
 	/// </summary>
-	bool isGameOver;
+	SpriteBatch ghostBatch;
 
 	/// <summary>
-	/// Is true when the player entered this game in multiplayer mode.
+	/// The batch every projectile is added to so they are drawn with a single draw call.
 	/// </summary>
-	bool isMultiplayer;
-
-	/// <summary>
-	/// A pointer to the screen manager that has this screen as a member as well as the callback functions.
-	/// </summary>
-	ScreenManager* parentManager;
-
-	/// <summary>
-	/// The callback function for sending enemies to the player connected on the network.
-	/// </summary>
-	void(ScreenManager::* onSendEnemies)(sf::Uint16 numberOfEnemies);
-
-	/// <summary>
-	/// The callback function for getting the number of enemies sent by the player on the network.
-	/// </summary>
-	sf::Uint16(ScreenManager::* onGetEnemies)();
-
-	/// <summary>
-	/// The unit of distance calculated on construction as a portion of the current screen dimensions.
-	/// </summary>
-	float unitOfDistance;
-
-	/// <summary>
-	/// The distance travelled since the last iteration, calculated using time, velocity, and unit of distance based on screen size.
-	/// </summary>
-	/// <returns>A number representing the units of distance travelled, where units of distance are based on screen size.</returns>
-	float distanceTravelled();
-
-	/// <summary>
-	/// A clock to track the time between iterations to ensure movements are time based and not processor speed based.
-	/// </summary>
-	sf::Clock clock;
-
-	/// <summary>
-	/// The time elapsed since the last iteration in microseconds.
-	/// </summary>
-	sf::Time timeElapsed;
-
-	/// <summary>
-	/// The texture containing the castle image.
-	/// </summary>
-	sf::Texture castleTexture;
-
-	/// <summary>
-	/// An array of textures containing the images for the different ghost frames.
-	/// </summary>
-	sf::Texture ghostTextures[14];
+	SpriteBatch projectileBatch;
 
 	/// <summary>
 	/// The modal that will display the shop.
@@ -242,17 +182,13 @@ private:
 	/// </summary>
 	bool isShopModalDisplayed;
 
-	/// <summary>
-	/// A list of pointers to active weapons.
-	/// </summary>
-	std::list<Weapon> weapons;
-
 	/// <summary>
 	/// Purchases the provided weapon type at the provided cost.
 	/// </summary>
 	/// <param name="cost">The cost of the weapon.</param>
 	/// <param name="type">The type of weapon to purchase.</param>
-	/// <returns>True if the player had enough money to purchase the weapon.</returns>
+	/// <returns>True if the player had enough money to purchase the weapon in the latest snapshot, after paying for the purchases queued
+	/// since. The simulation thread checks again when it applies the purchase.</returns>
 	bool purchaseWeapon(unsigned int cost, WeaponType type);
 
 	/// <summary>
@@ -260,30 +196,11 @@ private:
 	/// </summary>
 	void closeShopModal();
 
-	/// <summary>
-	/// Generate the given number of projectiles, pointing them at a randomly selected enemy.
-	/// </summary>
-	/// <param name="count">The number of projectile to create.</param>
-	void generateProjectiles(unsigned char count);
-
-	/// <summary>
-	/// Creates a new projectile and fires it at the provided coordinate.
-	/// </summary>
-	/// <param name="position">The position to fire the projectile at.</param>
-	void fireProjectileAt(sf::Vector2f position);
-
-	/// <summary>
-	/// Gets the position of a random enemy.
-	/// </summary>
-	/// <param name="position">The position that will be changed to match that of a random enemy.</param>
-	/// <returns>True if successfully found position of a random enemy.</returns>
-	bool getPositionOfRandomEnemy(sf::Vector2f& position);
-
 	//Audio
 	sf::Music music;
-	sf::SoundBuffer Hit;
-	sf::SoundBuffer Explosion;
-	sf::SoundBuffer Lose;
+	std::shared_ptr<const sf::SoundBuffer> Hit;
+	std::shared_ptr<const sf::SoundBuffer> Explosion;
+	std::shared_ptr<const sf::SoundBuffer> Lose;
 	sf::Sound sound; //To hold various soundbuffers
 	bool isGameOverMusic = false;//Stores whether or not game over music is playing
 };
@@ -0,0 +1,446 @@
+#include "SwarmSimulation.h"
+
+const static float enemyVelocity = 0.0001f;
+const static std::size_t maxProjectiles = 16384;
+const static std::size_t projectilesMovedPerRange = 2048;
+const static std::size_t projectilesTestedPerRange = 256;
+const static sf::Uint32 noHit = 0xFFFFFFFF;
+const static unsigned int destroyEnemiesSection = Profiler::getInstance().registerSection("sim.destroy_enemies");
+const static unsigned int spawnEnemiesSection = Profiler::getInstance().registerSection("sim.spawn_enemies");
+const static unsigned int movementSection = Profiler::getInstance().registerSection("sim.movement");
+const static unsigned int weaponsSection = Profiler::getInstance().registerSection("sim.weapons");
+const static unsigned int collisionsSection = Profiler::getInstance().registerSection("sim.collisions");
+const static unsigned int liveProjectilesCounter = Profiler::getInstance().registerCounter("sim.projectiles");
+
+SwarmSimulation::SwarmSimulation(
+	sf::VideoMode vm,
+	bool mp,
+	ScreenManager* manager,
+	void(ScreenManager::* sendEnemiesCallback)(sf::Uint16 numberOfEnemies),
+	sf::Uint16(ScreenManager::* getEnemiesCallback)(),
+	sf::Uint64 seed
+	) : spawnRandom(seed, RandomSubsystem::Spawning), targetingRandom(seed, RandomSubsystem::Targeting)
+{
+	videoMode = vm;
+	playerBase = new MoveableRectangle(sf::Vector2f(vm.height*0.1f, vm.height * 0.1f));
+	playerBase->centerHorizontal(videoMode);
+	playerBase->centerVertical(videoMode);
+	generateEnemy();
+
+	score = 0;
+	coins = 0;
+	health = 100;
+	isGameOver = false;
+	hitsLastStep = 0;
+	explosionsLastStep = 0;
+	timeElapsed = 0;
+	simulationMicroseconds = 0;
+	projectileLifetimeStats = ProjectileLifetimeStats();
+
+	isMultiplayer = mp;
+	parentManager = manager;
+	onSendEnemies = sendEnemiesCallback;
+	onGetEnemies = getEnemiesCallback;
+	enemiesCollided = 0;
+	unitOfDistance = hypotf((float)videoMode.height, (float)videoMode.width)*0.01f;
+	sf::Vector2f enemyDimensions = EnemyStore::getBaseDimensions(videoMode);
+	enemyGrid.configure(videoMode, std::max(unitOfDistance, std::max(enemyDimensions.x, enemyDimensions.y)));
+	projectiles.configure(videoMode, maxProjectiles);
+	workers = nullptr;
+	setThreadCount(1);
+}
+
+SwarmSimulation::~SwarmSimulation()
+{
+	delete playerBase;
+	playerBase = nullptr;
+	delete workers;
+	workers = nullptr;
+}
+
+void SwarmSimulation::setThreadCount(unsigned int threadCount)
+{
+	delete workers;
+	workers = new WorkerPool(threadCount);
+	participantCandidates.resize(workers->getThreadCount());
+}
+
+void SwarmSimulation::step(sf::Int64 microseconds)
+{
+	hitsLastStep = 0;
+	explosionsLastStep = 0;
+	enemies.storePreviousPositions();
+	for (std::size_t i = 0; i < projectiles.size(); ++i)
+	{
+		projectiles[i].storePreviousPosition();
+	}
+
+	if (isGameOver) return;
+
+	timeElapsed = microseconds;
+	simulationMicroseconds += microseconds;
+
+	{
+		ProfileScope scope(destroyEnemiesSection);
+		destroyEnemies();
+	}
+
+	{
+		ProfileScope scope(spawnEnemiesSection);
+		spawnEnemies();
+	}
+
+	{
+		ProfileScope scope(movementSection);
+		moveEnemies();
+		moveProjectiles();
+	}
+
+	{
+		ProfileScope scope(weaponsSection);
+		fireWeapons();
+	}
+
+	{
+		ProfileScope scope(collisionsSection);
+		checkForCollisions();
+		cullProjectiles();
+	}
+
+	Profiler::getInstance().setCounter(liveProjectilesCounter, (long long)projectiles.size());
+}
+
+void SwarmSimulation::generateEnemy()
+{
+	try
+	{
+		enemies.spawn(videoMode, spawnRandom);
+	}
+	catch (const std::exception& ex)
+	{
+		std::cout << "Failed to generate enemy: " << ex.what() << std::endl;
+	}
+
+}
+
+void SwarmSimulation::destroyEnemies()
+{
+	sf::Uint16 enemiesDestroyed = 0;
+	while (!enemiesToDestroy.empty())
+	{
+		// A stale handle means the enemy is already gone, since handles are generational
+		if (enemies.destroy(enemiesToDestroy.front()))
+		{
+			enemiesDestroyed++;
+		}
+
+		enemiesToDestroy.pop();
+	}
+
+	if (isMultiplayer)
+	{
+		if (enemiesDestroyed > enemiesCollided)
+		{
+			((*parentManager).*onSendEnemies)(enemiesDestroyed - enemiesCollided);
+		}
+		
+		enemiesCollided += ((*parentManager).*onGetEnemies)();
+	}
+	else
+	{
+		enemiesCollided = enemiesDestroyed;
+	}
+}
+
+void SwarmSimulation::spawnEnemies()
+{
+	for (int i = 0; i < enemiesCollided * 2; i++)
+	{
+		generateEnemy();
+	}
+	
+	enemiesCollided = 0;
+}
+
+void SwarmSimulation::moveEnemies()
+{
+	enemies.advanceTowards((float)videoMode.width / 2.0f, (float)videoMode.height / 2.0f, distanceTravelled(), *workers);
+
+	for (std::size_t i = 0; i < enemies.size(); ++i)
+	{
+		if (!enemies.hasFlag(i, EnemyFlag::IsDying))
+		{
+			if (enemies.hasFlag(i, EnemyFlag::DidAttack))
+			{
+				health = health <= 1 ? 0 : health-1;
+				enemiesCollided++;
+				enemies.die(i);
+				explosionsLastStep++;
+
+				if (health == 0)
+				{
+					isGameOver = true;
+				}
+			}
+		}
+
+		if (enemies.hasFlag(i, EnemyFlag::IsDead))
+		{
+			enemiesToDestroy.push(enemies.getHandle(i));
+		}
+	}
+
+	enemies.advanceAnimations(timeElapsed, *workers);
+}
+
+void SwarmSimulation::moveProjectiles()
+{
+	float distanceToShift = distanceTravelled() * 5;
+	workers->parallelFor(projectiles.size(), projectilesMovedPerRange, [this, distanceToShift](std::size_t begin, std::size_t end, unsigned int)
+	{
+		for (std::size_t i = begin; i < end; ++i) {
+			Projectile& projectile = projectiles[i];
+			if (!projectile.getHasHit())
+			{
+				projectile.shiftTowards(projectile.getxDest(), projectile.getyDest(), distanceToShift);
+			}
+		}
+	});
+}
+
+void SwarmSimulation::checkForCollisions()
+{
+	enemyGrid.rebuild(enemies);
+
+	AABB baseBounds = playerBase->getBounds();
+	collisionCandidates.clear();
+	enemyGrid.query(baseBounds, collisionCandidates);
+	enemies.gatherBounds(collisionCandidates.data(), collisionCandidates.size(), collisionCandidateBounds);
+	AABB::overlaps(collisionCandidateBounds.data(), collisionCandidateBounds.size(), baseBounds, collisionHitMask);
+	for (std::size_t i = 0; i < collisionCandidates.size(); ++i)
+	{
+		if ((collisionHitMask[i / 64] >> (i % 64)) & 1)
+		{
+			enemies.attack(collisionCandidates[i]);
+		}
+	}
+
+	projectileHits.resize(projectiles.size());
+	workers->parallelFor(projectiles.size(), projectilesTestedPerRange, [this](std::size_t begin, std::size_t end, unsigned int participant)
+	{
+		std::vector<sf::Uint32>& candidates = participantCandidates[participant];
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			AABB projectileBounds = projectiles[i].getBounds();
+			candidates.clear();
+			enemyGrid.query(projectileBounds, candidates);
+
+			// A projectile only has a handful of candidates, too few for the batched test to pay for gathering their bounds
+			projectileHits[i] = noHit;
+			for (std::size_t j = 0; j < candidates.size(); ++j)
+			{
+				if (enemies.getBounds(candidates[j]).overlaps(projectileBounds))
+				{
+					projectileHits[i] = candidates[j];
+					break;
+				}
+			}
+		}
+	});
+
+	// Releasing a projectile moves the last one into its place, so resolve from the last to the first to keep the unresolved ones in place
+	for (std::size_t i = projectiles.size(); i-- > 0;)
+	{
+		sf::Uint32 enemyIndex = projectileHits[i];
+		if (enemyIndex == noHit) continue;
+
+		if (!enemies.hasFlag(enemyIndex, EnemyFlag::IsDying))
+		{
+			score++;
+			coins += 10;
+			hitsLastStep++;
+		}
+		enemies.die(enemyIndex);
+		projectiles.release(i);
+		projectileLifetimeStats.hits++;
+	}
+}
+
+void SwarmSimulation::cullProjectiles()
+{
+	std::size_t i = 0;
+	while (i < projectiles.size())
+	{
+		Projectile& projectile = projectiles[i];
+		projectile.age(timeElapsed);
+
+		if (projectile.getDidArrive())
+		{
+			projectileLifetimeStats.arrivals++;
+		}
+		else if (projectile.isOffScreen(videoMode))
+		{
+			projectileLifetimeStats.offScreen++;
+		}
+		else if (projectile.getIsExpired())
+		{
+			projectileLifetimeStats.expirations++;
+		}
+		else {
+			++i;
+			continue;
+		}
+
+		projectiles.release(i);
+	}
+}
+
+float SwarmSimulation::distanceTravelled()
+{
+	return (float)timeElapsed * enemyVelocity;
+}
+
+bool SwarmSimulation::purchaseWeapon(unsigned int cost, WeaponType type)
+{
+	if (coins < cost) return false;
+	
+	coins -= cost;
+
+	switch (type)
+	{
+	case WeaponType::Basic:
+		weapons.push_back(Weapon(2000000, 1, TargetingPolicy::Random, this, &SwarmSimulation::generateProjectiles));
+		break;
+	case WeaponType::Seeking:
+		weapons.push_back(Weapon(4000000, 2, TargetingPolicy::ClosestToBase, this, &SwarmSimulation::generateProjectiles));
+		break;
+	default:
+		return true;
+	}
+
+	weaponScheduler.schedule(weapons.size() - 1, weapons.back().getFiringPeriod(), simulationMicroseconds);
+	return true;
+}
+
+void SwarmSimulation::fireWeapons()
+{
+	std::size_t weapon;
+	while (weaponScheduler.popDue(simulationMicroseconds, weapon))
+	{
+		weapons[weapon].fire();
+	}
+}
+
+void SwarmSimulation::addCoins(unsigned int amount)
+{
+	coins += amount;
+}
+
+unsigned int SwarmSimulation::getScore()
+{
+	return score;
+}
+
+unsigned int SwarmSimulation::getCoins()
+{
+	return coins;
+}
+
+unsigned short int SwarmSimulation::getHealth()
+{
+	return health;
+}
+
+bool SwarmSimulation::getIsGameOver()
+{
+	return isGameOver;
+}
+
+unsigned int SwarmSimulation::getHitsLastStep()
+{
+	return hitsLastStep;
+}
+
+unsigned int SwarmSimulation::getExplosionsLastStep()
+{
+	return explosionsLastStep;
+}
+
+EnemyStore& SwarmSimulation::getEnemies()
+{
+	return enemies;
+}
+
+ProjectilePool& SwarmSimulation::getProjectiles()
+{
+	return projectiles;
+}
+
+ProjectileLifetimeStats SwarmSimulation::getProjectileLifetimeStats()
+{
+	return projectileLifetimeStats;
+}
+
+std::size_t SwarmSimulation::getWeaponCount()
+{
+	return weapons.size();
+}
+
+void SwarmSimulation::writeSnapshot(RenderSnapshot& snapshot)
+{
+	enemies.writeSnapshots(snapshot.ghosts);
+
+	snapshot.projectiles.resize(projectiles.size());
+	for (std::size_t i = 0; i < projectiles.size(); ++i)
+	{
+		projectiles[i].writeSnapshot(snapshot.projectiles[i]);
+	}
+
+	snapshot.score = score;
+	snapshot.coins = coins;
+	snapshot.health = health;
+	snapshot.isGameOver = isGameOver;
+}
+
+MoveableRectangle* SwarmSimulation::getPlayerBase()
+{
+	return playerBase;
+}
+
+void SwarmSimulation::generateProjectiles(unsigned char count, TargetingPolicy policy)
+{
+	pickTargets(policy, count);
+	for (std::size_t i = 0; i < volleyTargets.size(); ++i)
+	{
+		fireProjectileAt(enemies.getCenterCoordinates(volleyTargets[i]));
+	}
+}
+
+void SwarmSimulation::fireProjectileAt(sf::Vector2f position)
+{
+	projectiles.acquire(position.x, position.y);
+}
+
+void SwarmSimulation::pickTargets(TargetingPolicy policy, std::size_t count)
+{
+	volleyTargets.clear();
+	std::size_t targetableCount = enemies.getTargetableCount();
+	count = std::min(count, targetableCount);
+
+	switch (policy)
+	{
+	case TargetingPolicy::ClosestToBase:
+		enemies.findClosestTargets(count, volleyTargets);
+		break;
+	default:
+		while (volleyTargets.size() < count)
+		{
+			std::size_t targetIndex = enemies.getTargetableIndex(targetingRandom.nextIndex((sf::Uint32)targetableCount));
+			if (std::find(volleyTargets.begin(), volleyTargets.end(), targetIndex) == volleyTargets.end())
+			{
+				volleyTargets.push_back(targetIndex);
+			}
+		}
+		break;
+	}
+}
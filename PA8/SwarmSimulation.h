@@ -0,0 +1,421 @@
+#ifndef SWARM_SIMULATION_H
+#define SWARM_SIMULATION_H
+
+#include "MoveableRectangle.h"
+#include <SFML/Graphics.hpp>
+#include <queue>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "EnemyStore.h"
+#include "EnemyGrid.h"
+#include "Projectile.h"
+#include "ProjectilePool.h"
+#include "WeaponType.h"
+#include "TargetingPolicy.h"
+#include "Weapon.h"
+#include "WeaponScheduler.h"
+#include "Profiler.h"
+#include "RandomStream.h"
+#include "WorkerPool.h"
+#include "RenderSnapshot.h"
+
+/// <summary>
+/// The number of projectiles removed from a simulation for each reason since it started.
+/// </summary>
+struct ProjectileLifetimeStats
+{
+	/// <summary>
+	/// The number of projectiles removed because they hit an enemy.
+	/// </summary>
+	unsigned long hits;
+
+	/// <summary>
+	/// The number of projectiles removed because they reached their destination without hitting anything.
+	/// </summary>
+	unsigned long arrivals;
+
+	/// <summary>
+	/// The number of projectiles removed because they left the screen.
+	/// </summary>
+	unsigned long offScreen;
+
+	/// <summary>
+	/// The number of projectiles removed because they were in flight for longer than their lifetime.
+	/// </summary>
+	unsigned long expirations;
+};
+
+/// <summary>
+/// Forward declaration of screen manager.
+/// </summary>
+class ScreenManager;
+
+/// <summary>
+/// Forward declaration of the benchmark, which times each phase of a step separately.
+/// </summary>
+class SwarmBenchmark;
+
+/// <summary>
+/// The rules of the swarm defense game: enemies, projectiles, weapons, score, coins and health. Holds no window, textures or audio, so it
+/// can be stepped without a display by the headless runner as well as by the swarm defense screen.
+/// </summary>
+class SwarmSimulation
+{
+	friend class SwarmBenchmark;
+
+public:
+	/// <summary>
+	/// Initializes the player's base, the first enemy and the broad phase grid.
+	/// </summary>
+	/// <param name="vm">The video mode the simulation is laid out for.</param>
+	/// <param name="mp">Whether the game is in multiplayer mode.</param>
+	/// <param name="manager">The screen manager that has the multiplayer callback functions. Only used in multiplayer mode.</param>
+	/// <param name="sendEnemiesCallback">The callback function to send enemies to the player connected on the network.</param>
+	/// <param name="getEnemiesCallback">The callback function to get the enemies sent by the player connected on the network.</param>
+	/// <param name="seed">The seed of every random stream in the simulation. The same seed and inputs replay the same game.</param>
+	SwarmSimulation(
+		sf::VideoMode vm,
+		bool mp,
+		ScreenManager* manager,
+		void(ScreenManager::* sendEnemiesCallback)(sf::Uint16 numberOfEnemies),
+		sf::Uint16(ScreenManager::* getEnemiesCallback)(),
+		sf::Uint64 seed
+		);
+
+	~SwarmSimulation();
+
+	/// <summary>
+	/// Advances the simulation by the provided time. The positions before the step are kept so rendering can interpolate between them
+	/// and the new positions. Does nothing else once the game is over.
+	/// </summary>
+	/// <param name="microseconds">The time in microseconds to advance by.</param>
+	void step(sf::Int64 microseconds);
+
+	/// <summary>
+	/// Sets the number of threads the data-parallel phases of each step run on: enemy movement, animation timers, projectile movement
+	/// and the narrow phase of the collisions. Everything that changes shared state runs on the calling thread in a fixed order, so the
+	/// results are the same whatever the number of threads.
+	/// </summary>
+	/// <param name="threadCount">The number of threads, including the calling thread. 0 or 1 runs every phase on the calling thread.</param>
+	void setThreadCount(unsigned int threadCount);
+
+	/// <summary>
+	/// Fires a projectile from the pool at the provided coordinate. The shot is dropped if every projectile in the pool is in flight.
+	/// </summary>
+	/// <param name="position">The position to fire the projectile at.</param>
+	void fireProjectileAt(sf::Vector2f position);
+
+	/// <summary>
+	/// Purchases the provided weapon type at the provided cost.
+	/// </summary>
+	/// <param name="cost">The cost of the weapon.</param>
+	/// <param name="type">The type of weapon to purchase.</param>
+	/// <returns>True if the player had enough money to purchase the weapon.</returns>
+	bool purchaseWeapon(unsigned int cost, WeaponType type);
+
+	/// <summary>
+	/// Gives the player the provided number of coins.
+	/// </summary>
+	/// <param name="amount">The number of coins to give.</param>
+	void addCoins(unsigned int amount);
+
+	/// <summary>
+	/// Gets the player's current score.
+	/// </summary>
+	/// <returns>The player's current score.</returns>
+	unsigned int getScore();
+
+	/// <summary>
+	/// Gets the player's current coins.
+	/// </summary>
+	/// <returns>The player's current coins.</returns>
+	unsigned int getCoins();
+
+	/// <summary>
+	/// Gets the player's current health.
+	/// </summary>
+	/// <returns>The player's current health.</returns>
+	unsigned short int getHealth();
+
+	/// <summary>
+	/// Returns true when the player has lost all of their health.
+	/// </summary>
+	/// <returns>True when the game is over.</returns>
+	bool getIsGameOver();
+
+	/// <summary>
+	/// Gets the number of enemies hit by a projectile during the last step.
+	/// </summary>
+	/// <returns>The number of enemies hit during the last step.</returns>
+	unsigned int getHitsLastStep();
+
+	/// <summary>
+	/// Gets the number of enemies that finished attacking the player's base during the last step.
+	/// </summary>
+	/// <returns>The number of enemies that finished attacking during the last step.</returns>
+	unsigned int getExplosionsLastStep();
+
+	/// <summary>
+	/// Gets the store holding every enemy currently alive.
+	/// </summary>
+	/// <returns>The store holding every enemy currently alive.</returns>
+	EnemyStore& getEnemies();
+
+	/// <summary>
+	/// Gets the pool holding the projectiles currently in flight.
+	/// </summary>
+	/// <returns>The pool holding the projectiles currently in flight.</returns>
+	ProjectilePool& getProjectiles();
+
+	/// <summary>
+	/// Gets the number of projectiles removed for each reason since the simulation started.
+	/// </summary>
+	/// <returns>The number of projectiles removed for each reason.</returns>
+	ProjectileLifetimeStats getProjectileLifetimeStats();
+
+	/// <summary>
+	/// Copies the ghosts, projectiles and HUD values into the provided snapshot. The tick counters of the snapshot are left to the caller.
+	/// </summary>
+	/// <param name="snapshot">The snapshot to write to. Its lists keep their capacity.</param>
+	void writeSnapshot(RenderSnapshot& snapshot);
+
+	/// <summary>
+	/// Gets the number of weapons the player has purchased.
+	/// </summary>
+	/// <returns>The number of weapons the player has purchased.</returns>
+	std::size_t getWeaponCount();
+
+	/// <summary>
+	/// Gets the rectangle containing the player's base.
+	/// </summary>
+	/// <returns>A pointer to the rectangle containing the player's base.</returns>
+	MoveableRectangle* getPlayerBase();
+
+private:
+	/// <summary>
+	/// A pointer to the rectangle containing the user's base.
+	/// </summary>
+	MoveableRectangle* playerBase;
+
+	/// <summary>
+	/// The video mode the simulation is laid out for.
+	/// </summary>
+	sf::VideoMode videoMode;
+
+	/// <summary>
+	/// The structure-of-arrays store holding every enemy currently alive.
+	/// </summary>
+	EnemyStore enemies;
+
+	/// <summary>
+	/// The random stream deciding where new enemies spawn.
+	/// </summary>
+	RandomStream spawnRandom;
+
+	/// <summary>
+	/// The random stream deciding which enemies the weapons fire at.
+	/// </summary>
+	RandomStream targetingRandom;
+
+	/// <summary>
+	/// The broad phase grid over the enemies, rebuilt once per step before collisions are checked.
+	/// </summary>
+	EnemyGrid enemyGrid;
+
+	/// <summary>
+	/// The enemy indices returned by the last grid query. Kept as a member so its capacity is reused between queries.
+	/// </summary>
+	std::vector<sf::Uint32> collisionCandidates;
+
+	/// <summary>
+	/// The bounding box of each enemy in collisionCandidates, in the same order.
+	/// </summary>
+	std::vector<AABB> collisionCandidateBounds;
+
+	/// <summary>
+	/// One bit per enemy in collisionCandidates, set when it overlaps the base.
+	/// </summary>
+	std::vector<sf::Uint64> collisionHitMask;
+
+	/// <summary>
+	/// The threads the data-parallel phases of each step run on.
+	/// </summary>
+	WorkerPool* workers;
+
+	/// <summary>
+	/// The enemy indices returned by the last grid query of each participant of the worker pool.
+	/// </summary>
+	std::vector<std::vector<sf::Uint32>> participantCandidates;
+
+	/// <summary>
+	/// The index of the enemy each projectile hit during the narrow phase of the current step, or 0xFFFFFFFF if it hit nothing.
+	/// </summary>
+	std::vector<sf::Uint32> projectileHits;
+
+	/// <summary>
+	/// Generates a new enemy and adds it to the store.
+	/// </summary>
+	void generateEnemy();
+
+	/// <summary>
+	/// A queue containing the handles of the enemies to be destroyed.
+	/// </summary>
+	std::queue<EnemyHandle> enemiesToDestroy;
+
+	/// <summary>
+	/// The number of enemies that have collided with the player's base.
+	/// </summary>
+	int enemiesCollided;
+
+	/// <summary>
+	/// The pool holding all projectiles currently in flight.
+	/// </summary>
+	ProjectilePool projectiles;
+
+	/// <summary>
+	/// The number of projectiles removed for each reason since the simulation started.
+	/// </summary>
+	ProjectileLifetimeStats projectileLifetimeStats;
+
+	/// <summary>
+	/// Every weapon the player has purchased, indexed by the ids given to the weapon scheduler.
+	/// </summary>
+	std::vector<Weapon> weapons;
+
+	/// <summary>
+	/// Decides which weapons fire during each step.
+	/// </summary>
+	WeaponScheduler weaponScheduler;
+
+	/// <summary>
+	/// The simulation time in microseconds: the total time of every step before the game ended.
+	/// </summary>
+	sf::Int64 simulationMicroseconds;
+
+	/// <summary>
+	/// Fires every weapon that is due by the current simulation time, as many times as it is due.
+	/// </summary>
+	void fireWeapons();
+
+	/// <summary>
+	/// The player's current score.
+	/// </summary>
+	unsigned int score;
+
+	/// <summary>
+	/// The player's current coins.
+	/// </summary>
+	unsigned int coins;
+
+	/// <summary>
+	/// The player's current health.
+	/// </summary>
+	unsigned short int health;
+
+	/// <summary>
+	/// Is true when the player loses all of their health.
+	/// </summary>
+	bool isGameOver;
+
+	/// <summary>
+	/// The number of enemies hit by a projectile during the last step.
+	/// </summary>
+	unsigned int hitsLastStep;
+
+	/// <summary>
+	/// The number of enemies that finished attacking the player's base during the last step.
+	/// </summary>
+	unsigned int explosionsLastStep;
+
+	/// <summary>
+	/// Destroy all enemies in the queue.
+	/// </summary>
+	void destroyEnemies();
+
+	/// <summary>
+	/// Spawns two new enemies for each enemy that collided with the player's base or was destroyed during this step.
+	/// </summary>
+	void spawnEnemies();
+
+	/// <summary>
+	/// Moves every enemy towards the player's base, damages the base for each enemy that finished attacking it and queues dead enemies
+	/// to be destroyed.
+	/// </summary>
+	void moveEnemies();
+
+	/// <summary>
+	/// Moves every projectile that has not hit an enemy towards its destination.
+	/// </summary>
+	void moveProjectiles();
+
+	/// <summary>
+	/// Check for any collisions between the enemies and the player's base or the projectiles. Each projectile that hits an enemy is destroyed.
+	/// </summary>
+	void checkForCollisions();
+
+	/// <summary>
+	/// Ages every projectile and removes those that reached their destination, left the screen or outlived their lifetime. Runs after the
+	/// collisions are checked, so a projectile arriving on an enemy still hits it.
+	/// </summary>
+	void cullProjectiles();
+
+	/// <summary>
+	/// Is true when the player entered this game in multiplayer mode.
+	/// </summary>
+	bool isMultiplayer;
+
+	/// <summary>
+	/// A pointer to the screen manager that has the callback functions.
+	/// </summary>
+	ScreenManager* parentManager;
+
+	/// <summary>
+	/// The callback function for sending enemies to the player connected on the network.
+	/// </summary>
+	void(ScreenManager::* onSendEnemies)(sf::Uint16 numberOfEnemies);
+
+	/// <summary>
+	/// The callback function for getting the number of enemies sent by the player on the network.
+	/// </summary>
+	sf::Uint16(ScreenManager::* onGetEnemies)();
+
+	/// <summary>
+	/// The unit of distance calculated on construction as a portion of the current screen dimensions.
+	/// </summary>
+	float unitOfDistance;
+
+	/// <summary>
+	/// The distance travelled since the last step, calculated using time, velocity, and unit of distance based on screen size.
+	/// </summary>
+	/// <returns>A number representing the units of distance travelled, where units of distance are based on screen size.</returns>
+	float distanceTravelled();
+
+	/// <summary>
+	/// The time elapsed during the current step in microseconds.
+	/// </summary>
+	sf::Int64 timeElapsed;
+
+	/// <summary>
+	/// The indices of the enemies picked for the current volley. Kept as a member so its capacity is reused between volleys.
+	/// </summary>
+	std::vector<std::size_t> volleyTargets;
+
+	/// <summary>
+	/// Fires a volley of the given number of projectiles, one at each of the enemies picked by the provided policy. Fires fewer if there
+	/// are fewer enemies to pick.
+	/// </summary>
+	/// <param name="count">The number of projectile to create.</param>
+	/// <param name="policy">How to pick the enemies to fire at.</param>
+	void generateProjectiles(unsigned char count, TargetingPolicy policy);
+
+	/// <summary>
+	/// Picks up to the provided number of different enemies with the provided policy and stores their indices in volleyTargets. Dying
+	/// enemies are never picked. Takes time proportional to the number picked, whatever the size of the swarm.
+	/// </summary>
+	/// <param name="policy">How to pick the enemies.</param>
+	/// <param name="count">The most enemies to pick.</param>
+	void pickTargets(TargetingPolicy policy, std::size_t count);
+};
+
+#endif // !SWARM_SIMULATION_H
@@ -0,0 +1,13 @@
+#ifndef TARGETING_POLICY_H
+#define TARGETING_POLICY_H
+
+/// <summary>
+/// Enum representing how a weapon picks the enemy it fires at. Dying enemies are never picked.
+/// </summary>
+enum class TargetingPolicy
+{
+	Random,
+	ClosestToBase
+};
+
+#endif // !TARGETING_POLICY_H
@@ -25,6 +25,7 @@ bool TcpClient::getIsConnected()
 
 void TcpClient::enqueueEnemies(sf::Uint16 numberOfEnemiesToSend)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	sf::Packet packet;
 	packet << numberOfEnemiesToSend;
 	packetQueue.push(packet);
@@ -33,6 +34,7 @@ void TcpClient::enqueueEnemies(sf::Uint16 numberOfEnemiesToSend)
 
 void TcpClient::sendFrontOfQueue()
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	if (socketStatus == sf::Socket::Disconnected)
 	{
 		socketStatus = socket->connect(address, port);
@@ -71,6 +73,7 @@ void TcpClient::sendFrontOfQueue()
 
 sf::Uint16 TcpClient::getEnemiesFromOpponent()
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	if (socketStatus == sf::Socket::Status::Disconnected)
 	{
 		socketStatus = socket->connect(address, port);
@@ -4,6 +4,7 @@
 #include <SFML/Network.hpp>
 #include <iostream>
 #include <queue>
+#include <mutex>
 
 /// <summary>
 /// Container class for managing the SFML TCP client implementation.
@@ -73,6 +74,12 @@ private:
 	/// The queue containing the messages (packets) to send to the server.
 	/// </summary>
 	std::queue<sf::Packet> packetQueue;
+
+	/// <summary>
+	/// Guards the socket and the message queue, since the simulation thread queues and receives enemies while the thread that owns the
+	/// window sends them.
+	/// </summary>
+	std::mutex mutex;
 };
 
 #endif // !TCP_CLIENT_H
@@ -22,6 +22,7 @@ TcpServer::~TcpServer()
 
 void TcpServer::attemptToConnect()
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
 	if (socketStatus == sf::Socket::Disconnected)
 	{
 		socketStatus = listener->accept(client);
@@ -48,6 +49,7 @@ bool TcpServer::getDidConnect()
 
 void TcpServer::enqueueEnemies(sf::Uint16 numberOfEnemiesToSend)
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
 	sf::Packet packet;
 	packet << numberOfEnemiesToSend;
 	packetQueue.push(packet);
@@ -56,6 +58,7 @@ void TcpServer::enqueueEnemies(sf::Uint16 numberOfEnemiesToSend)
 
 void TcpServer::sendFrontOfQueue()
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
 	if (socketStatus == sf::Socket::Status::Disconnected)
 	{
 		std::cout << "Disconnected!" << std::endl;
@@ -95,6 +98,7 @@ void TcpServer::sendFrontOfQueue()
 
 sf::Uint16 TcpServer::getEnemiesFromOpponent()
 {
+	std::lock_guard<std::recursive_mutex> lock(mutex);
 	sf::Packet packet;
 	if (client.receive(packet) != sf::Socket::Status::Done) return 0;
 
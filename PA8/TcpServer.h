@@ -3,6 +3,7 @@
 
 #include <SFML/Network.hpp>
 #include <queue>
+#include <mutex>
 
 /// <summary>
 /// Container class for managing the SFML TCP server implementation.
@@ -71,6 +72,12 @@ private:
 	/// The queue containing the messages (packets) to send to the server.
 	/// </summary>
 	std::queue<sf::Packet> packetQueue;
+
+	/// <summary>
+	/// Guards the sockets and the message queue, since the simulation thread queues and receives enemies while the thread that owns the
+	/// window sends them. Recursive because connecting queues a message and sending may reconnect.
+	/// </summary>
+	std::recursive_mutex mutex;
 };
 
 #endif // !TCP_SERVER_H
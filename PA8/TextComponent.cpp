@@ -3,77 +3,22 @@
 
 TextComponent::TextComponent(std::string textFile, std::string contents)
 {
-	if (!font.loadFromFile("assets/" + textFile))
-	{
-		std::cout << "Failed to load '" << textFile << "' text file." << std::endl;
-	}
-
-	text.setFont(font);
-	text.setString(contents);
-	text.setFillColor(sf::Color::Black);
-	text.setCharacterSize(100);
-	totalHeight = text.getGlobalBounds().height;
-	totalWidth = text.getGlobalBounds().width;
-	centerPosX = totalWidth / 2;
-	centerPosY = totalHeight / 2;
-	text.setOrigin(centerPosX, centerPosY);
-	
+	initialize(textFile, contents, 100, sf::Color::Black, 0.0f);
 }
 
 TextComponent::TextComponent(std::string textFile, std::string contents, unsigned int size)
 {
-	if (!font.loadFromFile("assets/" + textFile))
-	{
-		std::cout << "Failed to load '" << textFile << "' text file." << std::endl;
-	}
-
-	text.setFont(font);
-	text.setString(contents);
-	text.setFillColor(sf::Color::Black);
-	text.setCharacterSize(size);
-	totalHeight = text.getGlobalBounds().height;
-	totalWidth = text.getGlobalBounds().width;
-	centerPosX = totalWidth / 2;
-	centerPosY = totalHeight / 2;
-	text.setOrigin(centerPosX, centerPosY);
+	initialize(textFile, contents, size, sf::Color::Black, 0.0f);
 }
 
 TextComponent::TextComponent(std::string textFile, std::string contents, unsigned int size, sf::Color color)
 {
-	if (!font.loadFromFile("assets/" + textFile))
-	{
-		std::cout << "Failed to load '" << textFile << "' text file." << std::endl;
-	}
-
-	text.setFont(font);
-	text.setString(contents);
-	text.setFillColor(color);
-	text.setCharacterSize(size);
-	totalHeight = text.getGlobalBounds().height;
-	totalWidth = text.getGlobalBounds().width;
-	centerPosX = totalWidth / 2;
-	centerPosY = totalHeight / 2;
-	text.setOrigin(centerPosX, centerPosY);
+	initialize(textFile, contents, size, color, 0.0f);
 }
 
 TextComponent::TextComponent(std::string textFile, std::string contents, unsigned int size, float outlineThickness)
 {
-	if (!font.loadFromFile("assets/" + textFile))
-	{
-		std::cout << "Failed to load '" << textFile << "' text file." << std::endl;
-	}
-
-	text.setFont(font);
-	text.setString(contents);
-	text.setFillColor(sf::Color::Black);
-	text.setCharacterSize(size);
-	totalHeight = text.getGlobalBounds().height;
-	totalWidth = text.getGlobalBounds().width;
-	centerPosX = totalWidth / 2;
-	centerPosY = totalHeight / 2;
-	text.setOrigin(centerPosX, centerPosY);
-	text.setOutlineColor(sf::Color::Black);
-	text.setOutlineThickness(outlineThickness);
+	initialize(textFile, contents, size, sf::Color::Black, outlineThickness);
 }
 
 float TextComponent::getCenterPosX()
@@ -88,33 +33,142 @@ float TextComponent::getCenterPosY()
 
 float TextComponent::getWidth()
 {
-	return text.getGlobalBounds().width;
+	return bounds.width;
 }
 
 float TextComponent::getHeight()
 {
-	return text.getGlobalBounds().height;
+	return bounds.height;
 }
 
 void TextComponent::drawTo(sf::RenderWindow& window)
 {
-	window.draw(text);
+	if (vertices.getVertexCount() == 0) return;
+
+	sf::RenderStates states(&fontAtlas->getTexture());
+	states.transform.translate(position - origin);
+	window.draw(vertices, states);
 }
 
 void TextComponent::setText(std::string newText)
 {
 	float prevWidth = totalWidth;
-	text.setString(newText);
+	contents = newText;
+	buildVertices();
 	totalWidth = getWidth();
-	text.setOrigin(text.getOrigin().x + ((totalWidth - prevWidth) / 2), 0);
+	origin = sf::Vector2f(origin.x + ((totalWidth - prevWidth) / 2), 0);
 }
 
 void TextComponent::setColor(sf::Color newColor)
 {
-	text.setFillColor(newColor);
+	fillColor = newColor;
+	for (std::size_t i = fillStart; i < vertices.getVertexCount(); i++)
+	{
+		vertices[i].color = fillColor;
+	}
+}
+
+const sf::VertexArray& TextComponent::getVertices() const
+{
+	return vertices;
+}
+
+void TextComponent::initialize(const std::string& textFile, const std::string& text, unsigned int size, sf::Color color, float outlineThickness)
+{
+	fontAtlas = ResourceCache::getInstance().getFontAtlas("assets/" + textFile);
+	contents = text;
+	characterSize = size;
+	fillColor = color;
+	outline = outlineThickness;
+	vertices.setPrimitiveType(sf::Quads);
+	fillStart = 0;
+	position = sf::Vector2f(0.0f, 0.0f);
+	buildVertices();
+
+	totalHeight = bounds.height;
+	totalWidth = bounds.width;
+	centerPosX = totalWidth / 2;
+	centerPosY = totalHeight / 2;
+	origin = sf::Vector2f(centerPosX, centerPosY);
+}
+
+void TextComponent::buildVertices()
+{
+	vertices.clear();
+	fillStart = 0;
+	bounds = sf::FloatRect();
+	if (contents.empty()) return;
+
+	sf::Glyph space;
+	float whitespaceWidth = fontAtlas->getGlyph(' ', characterSize, 0.0f, space) ? space.advance : 0.0f;
+	float lineSpacing = fontAtlas->getLineSpacing(characterSize);
+
+	float minX = (float)characterSize;
+	float minY = (float)characterSize;
+	float maxX = 0.0f;
+	float maxY = 0.0f;
+
+	// The outline quads go first so the fill is drawn over them, as sf::Text does.
+	for (int pass = outline != 0.0f ? 0 : 1; pass < 2; pass++)
+	{
+		float thickness = pass == 0 ? outline : 0.0f;
+		sf::Color color = pass == 0 ? sf::Color::Black : fillColor;
+		if (pass == 1) fillStart = vertices.getVertexCount();
+
+		float x = 0.0f;
+		float y = (float)characterSize;
+		sf::Uint32 previous = 0;
+		for (std::size_t i = 0; i < contents.size(); i++)
+		{
+			sf::Uint32 character = (unsigned char)contents[i];
+			if (character == '\r') continue;
+
+			x += fontAtlas->getKerning(previous, character, characterSize);
+			previous = character;
+
+			if (character == ' ' || character == '\n' || character == '\t')
+			{
+				minX = std::min(minX, x);
+				minY = std::min(minY, y);
+				switch (character)
+				{
+				case ' ':
+					x += whitespaceWidth;
+					break;
+				case '\t':
+					x += whitespaceWidth * 4;
+					break;
+				case '\n':
+					y += lineSpacing;
+					x = 0.0f;
+					break;
+				}
+				maxX = std::max(maxX, x);
+				maxY = std::max(maxY, y);
+				continue;
+			}
+
+			sf::Glyph glyph;
+			if (!fontAtlas->getGlyph(character, characterSize, thickness, glyph)) continue;
+
+			FontAtlas::addGlyphQuad(vertices, sf::Vector2f(x, y), glyph, color, thickness);
+			minX = std::min(minX, x + glyph.bounds.left - thickness);
+			maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - thickness);
+			minY = std::min(minY, y + glyph.bounds.top - thickness);
+			maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height - thickness);
+
+			if (pass == 1) x += glyph.advance;
+			else {
+				sf::Glyph fillGlyph;
+				if (fontAtlas->getGlyph(character, characterSize, 0.0f, fillGlyph)) x += fillGlyph.advance;
+			}
+		}
+	}
+
+	bounds = sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
 }
 
 void TextComponent::updatePosition()
 {
-	text.setPosition(centerPosX, centerPosY);
+	position = sf::Vector2f(centerPosX, centerPosY);
 }
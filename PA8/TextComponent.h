@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "MoveableComponent.h"
+#include "ResourceCache.h"
 
 /// <summary>
 /// This class inherits MoveableComponent and renders text to the screen.
@@ -85,17 +86,78 @@ public:
 	/// <param name="newColor">The new color for the text.</param>
 	void setColor(sf::Color newColor);
 
+	/// <summary>
+	/// Gets the quads of the text: the outline quads of every character followed by their fill quads, relative to the position of the text.
+	/// </summary>
+	/// <returns>The quads of the text.</returns>
+	const sf::VertexArray& getVertices() const;
+
 private:
 
 	/// <summary>
-	/// The underlying text component.
+	/// The glyphs the text is built from, shared with every other text component using the same font.
+	/// </summary>
+	std::shared_ptr<const FontAtlas> fontAtlas;
+
+	/// <summary>
+	/// The words to be displayed.
+	/// </summary>
+	std::string contents;
+
+	/// <summary>
+	/// The font size.
+	/// </summary>
+	unsigned int characterSize;
+
+	/// <summary>
+	/// The fill color of the text.
+	/// </summary>
+	sf::Color fillColor;
+
+	/// <summary>
+	/// The thickness of the black outline around the text, or 0 for no outline.
+	/// </summary>
+	float outline;
+
+	/// <summary>
+	/// The quads of the text, built from the font atlas whenever the words change.
 	/// </summary>
-	sf::Text text;
+	sf::VertexArray vertices;
+
+	/// <summary>
+	/// The index of the first fill vertex. The vertices before it belong to the outline.
+	/// </summary>
+	std::size_t fillStart;
+
+	/// <summary>
+	/// The bounding box of the quads, relative to the position of the text.
+	/// </summary>
+	sf::FloatRect bounds;
+
+	/// <summary>
+	/// The point of the text placed at its position.
+	/// </summary>
+	sf::Vector2f origin;
+
+	/// <summary>
+	/// Where the origin of the text is drawn.
+	/// </summary>
+	sf::Vector2f position;
+
+	/// <summary>
+	/// Gets the font atlas and builds the quads of the words to be displayed, then centers the origin.
+	/// </summary>
+	/// <param name="textFile">The file name of the font.</param>
+	/// <param name="text">The words to be displayed.</param>
+	/// <param name="size">The font size.</param>
+	/// <param name="color">The fill color of the text.</param>
+	/// <param name="outlineThickness">The thickness of the black outline, or 0 for no outline.</param>
+	void initialize(const std::string& textFile, const std::string& text, unsigned int size, sf::Color color, float outlineThickness);
 
 	/// <summary>
-	/// The underyling font component.
+	/// Rebuilds the quads and the bounding box of the text the way sf::Text lays it out.
 	/// </summary>
-	sf::Font font;
+	void buildVertices();
 
 	/// <summary>
 	/// Updates the position of this component such that it aligns correctly with its current center coordinates.
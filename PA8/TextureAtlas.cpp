@@ -0,0 +1,270 @@
+#include "TextureAtlas.h"
+
+const static unsigned int padding = 1;
+const static unsigned int defaultMaxWidth = 2048;
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+bool TextureAtlas::load(const std::string& specPath, const std::string& atlasName)
+{
+	sf::Image atlasImage;
+	std::map<std::string, sf::IntRect> imageRects;
+	if (!decode(specPath, atlasName, atlasImage, imageRects)) return false;
+
+	return loadFromImage(atlasImage, imageRects);
+}
+
+bool TextureAtlas::loadFromManifest(const std::string& manifestPath)
+{
+	sf::Image atlasImage;
+	std::map<std::string, sf::IntRect> imageRects;
+	if (!decodeManifest(manifestPath, atlasImage, imageRects)) return false;
+
+	return loadFromImage(atlasImage, imageRects);
+}
+
+bool TextureAtlas::loadFromImage(const sf::Image& atlasImage, const std::map<std::string, sf::IntRect>& imageRects)
+{
+	if (!texture.loadFromImage(atlasImage))
+	{
+		std::cout << "Failed to create the texture atlas." << std::endl;
+		return false;
+	}
+
+	rects = imageRects;
+	return true;
+}
+
+bool TextureAtlas::loadFromFiles(const std::vector<std::string>& paths)
+{
+	sf::Image atlasImage;
+	std::map<std::string, sf::IntRect> packedRects;
+	if (!packImages(paths, atlasImage, packedRects)) return false;
+
+	return loadFromImage(atlasImage, packedRects);
+}
+
+bool TextureAtlas::getRect(const std::string& name, sf::IntRect& rect) const
+{
+	std::map<std::string, sf::IntRect>::const_iterator found = rects.find(name);
+	if (found == rects.end()) return false;
+
+	rect = found->second;
+	return true;
+}
+
+bool TextureAtlas::applyTo(sf::RectangleShape& shape, const std::string& name) const
+{
+	sf::IntRect rect;
+	if (!getRect(name, rect))
+	{
+		std::cout << "Failed to find " << name << " in texture atlas." << std::endl;
+		return false;
+	}
+
+	shape.setTexture(&texture);
+	shape.setTextureRect(rect);
+	return true;
+}
+
+const sf::Texture& TextureAtlas::getTexture() const
+{
+	return texture;
+}
+
+bool TextureAtlas::decode(const std::string& specPath, const std::string& atlasName, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& imageRects)
+{
+	std::string directory = getDirectory(specPath);
+	std::ifstream manifest(directory + atlasName + ".atlas");
+	if (manifest.is_open())
+	{
+		manifest.close();
+		if (decodeManifest(directory + atlasName + ".atlas", atlasImage, imageRects)) return true;
+	}
+
+	std::map<std::string, std::vector<std::string>> atlases;
+	if (!readSpec(specPath, atlases)) return false;
+
+	std::map<std::string, std::vector<std::string>>::const_iterator found = atlases.find(atlasName);
+	if (found == atlases.end())
+	{
+		std::cout << "Atlas " << atlasName << " is not listed in " << specPath << "." << std::endl;
+		return false;
+	}
+
+	return packImages(found->second, atlasImage, imageRects);
+}
+
+bool TextureAtlas::decodeManifest(const std::string& manifestPath, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& imageRects)
+{
+	std::ifstream file(manifestPath);
+	if (!file.is_open())
+	{
+		std::cout << "Failed to open atlas manifest " << manifestPath << "." << std::endl;
+		return false;
+	}
+
+	std::string keyword;
+	std::string textureFileName;
+	if (!(file >> keyword >> textureFileName) || keyword != "texture")
+	{
+		std::cout << "Atlas manifest " << manifestPath << " does not start with a texture." << std::endl;
+		return false;
+	}
+
+	std::map<std::string, sf::IntRect> loadedRects;
+	std::string name;
+	sf::IntRect rect;
+	while (file >> name >> rect.left >> rect.top >> rect.width >> rect.height)
+	{
+		loadedRects[name] = rect;
+	}
+
+	if (!file.eof())
+	{
+		std::cout << "Failed to parse atlas manifest " << manifestPath << "." << std::endl;
+		return false;
+	}
+
+	if (!atlasImage.loadFromFile(getDirectory(manifestPath) + textureFileName))
+	{
+		std::cout << "Failed to load atlas texture " << textureFileName << "." << std::endl;
+		return false;
+	}
+
+	imageRects = loadedRects;
+	return true;
+}
+
+bool TextureAtlas::readSpec(const std::string& specPath, std::map<std::string, std::vector<std::string>>& atlases)
+{
+	std::ifstream file(specPath);
+	if (!file.is_open())
+	{
+		std::cout << "Failed to open atlas spec " << specPath << "." << std::endl;
+		return false;
+	}
+
+	std::string directory = getDirectory(specPath);
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream words(line);
+		std::string atlasName;
+		if (!(words >> atlasName) || atlasName[0] == '#') continue;
+
+		std::vector<std::string>& paths = atlases[atlasName];
+		std::string imageFileName;
+		while (words >> imageFileName)
+		{
+			paths.push_back(directory + imageFileName);
+		}
+	}
+
+	return true;
+}
+
+bool TextureAtlas::packImages(const std::vector<std::string>& paths, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& packedRects)
+{
+	std::vector<sf::Image> images(paths.size());
+	std::vector<sf::Vector2u> sizes;
+	for (std::size_t i = 0; i < paths.size(); i++)
+	{
+		if (!images[i].loadFromFile(paths[i]))
+		{
+			std::cout << "Failed to load " << paths[i] << " into the texture atlas." << std::endl;
+			return false;
+		}
+
+		sizes.push_back(images[i].getSize());
+	}
+
+	std::vector<sf::IntRect> placedRects;
+	sf::Vector2u atlasSize = pack(sizes, defaultMaxWidth, placedRects);
+
+	atlasImage.create(std::max(atlasSize.x, 1u), std::max(atlasSize.y, 1u), sf::Color::Transparent);
+	packedRects.clear();
+	for (std::size_t i = 0; i < paths.size(); i++)
+	{
+		atlasImage.copy(images[i], placedRects[i].left, placedRects[i].top);
+		packedRects[getNameFromPath(paths[i])] = placedRects[i];
+	}
+
+	return true;
+}
+
+bool TextureAtlas::writeManifest(const std::string& manifestPath, const std::string& textureFileName, const std::map<std::string, sf::IntRect>& packedRects)
+{
+	std::ofstream file(manifestPath);
+	if (!file.is_open())
+	{
+		std::cout << "Failed to write atlas manifest " << manifestPath << "." << std::endl;
+		return false;
+	}
+
+	file << "texture " << textureFileName << std::endl;
+	for (std::map<std::string, sf::IntRect>::const_iterator i = packedRects.begin(); i != packedRects.end(); i++)
+	{
+		file << i->first << " " << i->second.left << " " << i->second.top << " " << i->second.width << " " << i->second.height << std::endl;
+	}
+
+	return file.good();
+}
+
+sf::Vector2u TextureAtlas::pack(const std::vector<sf::Vector2u>& sizes, unsigned int maxWidth, std::vector<sf::IntRect>& rects)
+{
+	std::vector<std::size_t> order(sizes.size());
+	for (std::size_t i = 0; i < order.size(); i++)
+	{
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) { return sizes[a].y > sizes[b].y; });
+
+	rects.assign(sizes.size(), sf::IntRect());
+	sf::Vector2u packedSize(0, 0);
+	unsigned int shelfX = 0;
+	unsigned int shelfY = 0;
+	unsigned int shelfHeight = 0;
+	for (std::size_t i = 0; i < order.size(); i++)
+	{
+		sf::Vector2u size = sizes[order[i]];
+		if (shelfX > 0 && shelfX + size.x > maxWidth)
+		{
+			shelfY += shelfHeight + padding;
+			shelfX = 0;
+			shelfHeight = 0;
+		}
+
+		rects[order[i]] = sf::IntRect((int)shelfX, (int)shelfY, (int)size.x, (int)size.y);
+		packedSize.x = std::max(packedSize.x, shelfX + size.x);
+		packedSize.y = std::max(packedSize.y, shelfY + size.y);
+		shelfX += size.x + padding;
+		shelfHeight = std::max(shelfHeight, size.y);
+	}
+
+	return packedSize;
+}
+
+std::string TextureAtlas::getNameFromPath(const std::string& path)
+{
+	std::size_t start = path.find_last_of("/\\");
+	start = start == std::string::npos ? 0 : start + 1;
+	std::size_t end = path.find_last_of('.');
+	if (end == std::string::npos || end < start) end = path.size();
+
+	return path.substr(start, end - start);
+}
+
+std::string TextureAtlas::getDirectory(const std::string& path)
+{
+	std::size_t end = path.find_last_of("/\\");
+	if (end == std::string::npos) return "";
+
+	return path.substr(0, end + 1);
+}
@@ -0,0 +1,168 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+/// <summary>
+/// A single texture holding several images, each of which is looked up by name as a sub-rectangle of the texture. Drawing from one atlas
+/// instead of many textures avoids a texture switch per sprite and lets sprites be batched into one draw call.
+/// 
+/// The atlases are listed in a spec file with one atlas per line: the atlas name followed by the image files it holds, relative to the
+/// spec file. Lines starting with # are ignored. The atlas packer packs each atlas at build time into NAME_atlas.png next to the spec file,
+/// along with a NAME.atlas manifest. The manifest starts with "texture FILE" and then holds one "name left top width height" line per image.
+/// </summary>
+class TextureAtlas
+{
+public:
+	/// <summary>
+	/// Initializes an empty atlas.
+	/// </summary>
+	TextureAtlas();
+
+	~TextureAtlas();
+
+	/// <summary>
+	/// Loads the atlas with the provided name from the manifest packed at build time. If the manifest is missing, packs the images listed
+	/// in the spec file instead.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas to load.</param>
+	/// <returns>True if the atlas was loaded.</returns>
+	bool load(const std::string& specPath, const std::string& atlasName);
+
+	/// <summary>
+	/// Loads the atlas texture and the rectangle of each image from the provided manifest.
+	/// </summary>
+	/// <param name="manifestPath">The path of the manifest file.</param>
+	/// <returns>True if the manifest and its texture were loaded.</returns>
+	bool loadFromManifest(const std::string& manifestPath);
+
+	/// <summary>
+	/// Creates the atlas texture from an image decoded beforehand, such as by decode on another thread.
+	/// </summary>
+	/// <param name="atlasImage">The image holding every image in the atlas.</param>
+	/// <param name="imageRects">The rectangle of each image in the atlas image, by name.</param>
+	/// <returns>True if the texture was created.</returns>
+	bool loadFromImage(const sf::Image& atlasImage, const std::map<std::string, sf::IntRect>& imageRects);
+
+	/// <summary>
+	/// Loads the provided image files and packs them into the atlas texture. Each image is named after its file name without the directory
+	/// or extension, so "assets/castle.png" is named "castle".
+	/// </summary>
+	/// <param name="paths">The paths of the image files.</param>
+	/// <returns>True if every image was loaded and packed.</returns>
+	bool loadFromFiles(const std::vector<std::string>& paths);
+
+	/// <summary>
+	/// Gets the rectangle of the texture holding the image with the provided name.
+	/// </summary>
+	/// <param name="name">The name of the image.</param>
+	/// <param name="rect">Set to the rectangle of the image if found.</param>
+	/// <returns>True if the atlas holds an image with the provided name.</returns>
+	bool getRect(const std::string& name, sf::IntRect& rect) const;
+
+	/// <summary>
+	/// Sets the texture of the provided shape to the image with the provided name.
+	/// </summary>
+	/// <param name="shape">The shape that will show the image.</param>
+	/// <param name="name">The name of the image.</param>
+	/// <returns>True if the atlas holds an image with the provided name.</returns>
+	bool applyTo(sf::RectangleShape& shape, const std::string& name) const;
+
+	/// <summary>
+	/// Gets the texture holding every image in the atlas.
+	/// </summary>
+	/// <returns>The texture of the atlas.</returns>
+	const sf::Texture& getTexture() const;
+
+	/// <summary>
+	/// Reads the image of the atlas with the provided name and the rectangle of each image in it without creating a texture, so it can be
+	/// called from a thread other than the one that draws. Reads the manifest packed at build time, or packs the images listed in the spec
+	/// file if the manifest is missing.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file listing the atlases.</param>
+	/// <param name="atlasName">The name of the atlas to read.</param>
+	/// <param name="atlasImage">Set to the image holding every image in the atlas.</param>
+	/// <param name="imageRects">Set to the rectangle of each image in the atlas image, by name.</param>
+	/// <returns>True if the atlas was read.</returns>
+	static bool decode(const std::string& specPath, const std::string& atlasName, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& imageRects);
+
+	/// <summary>
+	/// Reads the image and the rectangle of each image in it from the provided manifest without creating a texture.
+	/// </summary>
+	/// <param name="manifestPath">The path of the manifest file.</param>
+	/// <param name="atlasImage">Set to the image holding every image in the atlas.</param>
+	/// <param name="imageRects">Set to the rectangle of each image in the atlas image, by name.</param>
+	/// <returns>True if the manifest and its image were read.</returns>
+	static bool decodeManifest(const std::string& manifestPath, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& imageRects);
+
+	/// <summary>
+	/// Reads every atlas from the provided spec file.
+	/// </summary>
+	/// <param name="specPath">The path of the spec file.</param>
+	/// <param name="atlases">Set to the paths of the image files of each atlas, by atlas name.</param>
+	/// <returns>True if the spec file was read.</returns>
+	static bool readSpec(const std::string& specPath, std::map<std::string, std::vector<std::string>>& atlases);
+
+	/// <summary>
+	/// Loads the provided image files and packs them into a single image.
+	/// </summary>
+	/// <param name="paths">The paths of the image files.</param>
+	/// <param name="atlasImage">Set to the packed image.</param>
+	/// <param name="packedRects">Set to the rectangle of each image in the packed image, by name.</param>
+	/// <returns>True if every image was loaded.</returns>
+	static bool packImages(const std::vector<std::string>& paths, sf::Image& atlasImage, std::map<std::string, sf::IntRect>& packedRects);
+
+	/// <summary>
+	/// Writes a manifest for the provided packed rectangles.
+	/// </summary>
+	/// <param name="manifestPath">The path of the manifest file to write.</param>
+	/// <param name="textureFileName">The file name of the packed image, relative to the manifest.</param>
+	/// <param name="packedRects">The rectangle of each image in the packed image, by name.</param>
+	/// <returns>True if the manifest was written.</returns>
+	static bool writeManifest(const std::string& manifestPath, const std::string& textureFileName, const std::map<std::string, sf::IntRect>& packedRects);
+
+	/// <summary>
+	/// Places rectangles of the provided sizes on shelves from tallest to shortest without overlapping. Each rectangle is kept one pixel
+	/// away from its neighbours so texture filtering never samples a neighbouring image.
+	/// </summary>
+	/// <param name="sizes">The width and height of each rectangle.</param>
+	/// <param name="maxWidth">The widest the packed area may be, unless a single rectangle is wider.</param>
+	/// <param name="rects">Set to the placed rectangle for each size, in the same order.</param>
+	/// <returns>The width and height of the packed area.</returns>
+	static sf::Vector2u pack(const std::vector<sf::Vector2u>& sizes, unsigned int maxWidth, std::vector<sf::IntRect>& rects);
+
+	/// <summary>
+	/// Gets the name of an image from its path by removing the directory and extension.
+	/// </summary>
+	/// <param name="path">The path of the image file.</param>
+	/// <returns>The name of the image.</returns>
+	static std::string getNameFromPath(const std::string& path);
+
+	/// <summary>
+	/// Gets the directory of the provided path, including the trailing separator.
+	/// </summary>
+	/// <param name="path">The path of a file.</param>
+	/// <returns>The directory of the file, or an empty string if the path has no directory.</returns>
+	static std::string getDirectory(const std::string& path);
+
+private:
+	/// <summary>
+	/// The texture holding every image in the atlas.
+	/// </summary>
+	sf::Texture texture;
+
+	/// <summary>
+	/// The rectangle of the texture holding each image, by name.
+	/// </summary>
+	std::map<std::string, sf::IntRect> rects;
+};
+
+#endif // !TEXTURE_ATLAS_H
@@ -0,0 +1,97 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+/// <summary>
+/// Hands values from one writing thread to one reading thread without locks. The writer fills a back buffer and publishes it, the reader
+/// takes the most recently published buffer, and a third buffer sits between them so neither ever waits for the other. A published buffer
+/// is never written again until the reader has moved past it, so the reader can treat it as immutable. Buffers are reused, so a value that
+/// holds containers keeps their capacity from one publish to the next.
+/// </summary>
+template <typename T>
+class TripleBuffer
+{
+public:
+	/// <summary>
+	/// Initializes the three buffers with default values. The reader starts on a buffer that was never written.
+	/// </summary>
+	TripleBuffer()
+	{
+		backIndex = 0;
+		middle.store(1);
+		frontIndex = 2;
+	}
+
+	/// <summary>
+	/// Gets the buffer the writer fills next. Only called by the writing thread.
+	/// </summary>
+	/// <returns>The back buffer.</returns>
+	T& getWriteBuffer()
+	{
+		return buffers[backIndex];
+	}
+
+	/// <summary>
+	/// Publishes the back buffer to the reader and gives the writer the buffer the reader is not using. Only called by the writing thread.
+	/// A published buffer the reader has not acquired yet is replaced.
+	/// </summary>
+	void publish()
+	{
+		backIndex = middle.exchange(backIndex | isFresh, std::memory_order_acq_rel) & indexMask;
+	}
+
+	/// <summary>
+	/// Moves the reader onto the most recently published buffer, if one was published since the last call. Only called by the reading thread.
+	/// </summary>
+	/// <returns>True if the reader moved onto a newer buffer.</returns>
+	bool acquire()
+	{
+		if ((middle.load(std::memory_order_relaxed) & isFresh) == 0) return false;
+
+		frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & indexMask;
+		return true;
+	}
+
+	/// <summary>
+	/// Gets the buffer the reader acquired last. Only called by the reading thread.
+	/// </summary>
+	/// <returns>The front buffer.</returns>
+	const T& getReadBuffer() const
+	{
+		return buffers[frontIndex];
+	}
+
+private:
+	/// <summary>
+	/// The bits of the middle index holding the buffer index.
+	/// </summary>
+	static const unsigned char indexMask = 3;
+
+	/// <summary>
+	/// The bit of the middle index set when the middle buffer was published and not yet acquired.
+	/// </summary>
+	static const unsigned char isFresh = 4;
+
+	/// <summary>
+	/// The three buffers.
+	/// </summary>
+	T buffers[3];
+
+	/// <summary>
+	/// The buffer the writer fills. Only touched by the writing thread.
+	/// </summary>
+	unsigned char backIndex;
+
+	/// <summary>
+	/// The buffer between the writer and the reader, with isFresh set if it was published since the reader last acquired.
+	/// </summary>
+	std::atomic<unsigned char> middle;
+
+	/// <summary>
+	/// The buffer the reader is using. Only touched by the reading thread.
+	/// </summary>
+	unsigned char frontIndex;
+};
+
+#endif // !TRIPLE_BUFFER_H
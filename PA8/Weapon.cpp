@@ -1,24 +1,30 @@
 #include "Weapon.h"
 
-Weapon::Weapon(sf::Int64 fp, unsigned char pc, SwarmDefense* swarmDefense, void(SwarmDefense::* generateProjectileCallback)(unsigned char count))
+Weapon::Weapon(
+	sf::Int64 fp,
+	unsigned char pc,
+	TargetingPolicy tp,
+	SwarmSimulation* swarmSimulation,
+	void(SwarmSimulation::* generateProjectileCallback)(unsigned char count, TargetingPolicy policy)
+	)
 {
 	firingPeriod = fp;
 	projectileCount = pc;
-	parent = swarmDefense;
+	targetingPolicy = tp;
+	parent = swarmSimulation;
 	onGenerateProjectile = generateProjectileCallback;
-	microSecondsElapsed = 0;
 }
 
 Weapon::~Weapon()
 {
 }
 
-void Weapon::setTimeElapsed(sf::Int64 timeElapsed)
+void Weapon::fire()
 {
-	microSecondsElapsed += timeElapsed;
-	if (microSecondsElapsed > firingPeriod)
-	{
-		microSecondsElapsed -= firingPeriod;
-		((*parent).*onGenerateProjectile)(projectileCount);
-	}
+	((*parent).*onGenerateProjectile)(projectileCount, targetingPolicy);
+}
+
+sf::Int64 Weapon::getFiringPeriod()
+{
+	return firingPeriod;
 }
@@ -3,8 +3,9 @@
 
 #include <SFML/Graphics.hpp>
 #include "WeaponType.h"
+#include "TargetingPolicy.h"
 
-class SwarmDefense;
+class SwarmSimulation;
 
 class Weapon
 {
@@ -14,15 +15,27 @@ public:
 	/// </summary>
 	/// <param name="fp">The time this weapon waits in microseconds between each time it fires.</param>
 	/// <param name="pc">The number of projectiles this weapon fires each time.</param>
-	Weapon(sf::Int64 fp, unsigned char pc, SwarmDefense* swarmDefense, void(SwarmDefense::* generateProjectileCallback)(unsigned char count));
+	/// <param name="tp">How this weapon picks the enemy it fires at.</param>
+	Weapon(
+		sf::Int64 fp,
+		unsigned char pc,
+		TargetingPolicy tp,
+		SwarmSimulation* swarmSimulation,
+		void(SwarmSimulation::* generateProjectileCallback)(unsigned char count, TargetingPolicy policy)
+		);
 
 	~Weapon();
 
 	/// <summary>
-	/// Updates the time elapsed since the last iteration. Will trigger this weapon to fire if cumulative time elapsed crosses a firingPeriod threshold.
+	/// Fires this weapon's projectiles. Called by the weapon scheduler once every firingPeriod.
 	/// </summary>
-	/// <param name="timeElapsed">The time in microseconds that have elapsed since the last iteration.</param>
-	void setTimeElapsed(sf::Int64 timeElapsed);
+	void fire();
+
+	/// <summary>
+	/// Gets the time this weapon waits between each time it fires.
+	/// </summary>
+	/// <returns>The time in microseconds between each time this weapon fires.</returns>
+	sf::Int64 getFiringPeriod();
 
 private:
 	/// <summary>
@@ -31,24 +44,24 @@ private:
 	sf::Int64 firingPeriod;
 
 	/// <summary>
-	/// Stores the cumulative time elapsed until the firingPeriod is reached, at which point its value is decreased by firingPeriod and this weapon fires.
+	/// The number of projectiles this weapon fires each time.
 	/// </summary>
-	sf::Int64 microSecondsElapsed;
+	unsigned char projectileCount;
 
 	/// <summary>
-	/// The number of projectiles this weapon fires each time.
+	/// How this weapon picks the enemy it fires at.
 	/// </summary>
-	unsigned char projectileCount;
+	TargetingPolicy targetingPolicy;
 
 	/// <summary>
 	/// The parent component. Used as reference for the callback function.
 	/// </summary>
-	SwarmDefense* parent;
+	SwarmSimulation* parent;
 
 	/// <summary>
 	/// The callback function for generating a projectile in the parent component.
 	/// </summary>
-	void(SwarmDefense::* onGenerateProjectile)(unsigned char count);
+	void(SwarmSimulation::* onGenerateProjectile)(unsigned char count, TargetingPolicy policy);
 };
 
 #endif // !WEAPON_H
@@ -0,0 +1,43 @@
+#include "WeaponScheduler.h"
+
+WeaponScheduler::WeaponScheduler()
+{
+}
+
+WeaponScheduler::~WeaponScheduler()
+{
+}
+
+void WeaponScheduler::schedule(std::size_t weapon, sf::Int64 firingPeriod, sf::Int64 nowMicroseconds)
+{
+	ScheduledWeapon scheduled;
+	scheduled.nextFireMicroseconds = nowMicroseconds + firingPeriod;
+	scheduled.firingPeriod = firingPeriod;
+	scheduled.weapon = weapon;
+	heap.push_back(scheduled);
+	std::push_heap(heap.begin(), heap.end(), &WeaponScheduler::firesAfter);
+}
+
+bool WeaponScheduler::popDue(sf::Int64 nowMicroseconds, std::size_t& weapon)
+{
+	if (heap.empty() || heap.front().nextFireMicroseconds > nowMicroseconds) return false;
+
+	std::pop_heap(heap.begin(), heap.end(), &WeaponScheduler::firesAfter);
+	ScheduledWeapon& due = heap.back();
+	weapon = due.weapon;
+	due.nextFireMicroseconds += due.firingPeriod;
+	std::push_heap(heap.begin(), heap.end(), &WeaponScheduler::firesAfter);
+	return true;
+}
+
+std::size_t WeaponScheduler::size() const
+{
+	return heap.size();
+}
+
+bool WeaponScheduler::firesAfter(const ScheduledWeapon& a, const ScheduledWeapon& b)
+{
+	if (a.nextFireMicroseconds != b.nextFireMicroseconds) return a.nextFireMicroseconds > b.nextFireMicroseconds;
+
+	return a.weapon > b.weapon;
+}
@@ -0,0 +1,82 @@
+#ifndef WEAPON_SCHEDULER_H
+#define WEAPON_SCHEDULER_H
+
+#include <SFML/Config.hpp>
+#include <vector>
+#include <algorithm>
+
+/// <summary>
+/// A weapon's place in the weapon scheduler.
+/// </summary>
+struct ScheduledWeapon
+{
+	/// <summary>
+	/// The simulation time in microseconds at which the weapon fires next.
+	/// </summary>
+	sf::Int64 nextFireMicroseconds;
+
+	/// <summary>
+	/// The time in microseconds between each time the weapon fires.
+	/// </summary>
+	sf::Int64 firingPeriod;
+
+	/// <summary>
+	/// The id of the weapon, as given when it was scheduled.
+	/// </summary>
+	std::size_t weapon;
+};
+
+/// <summary>
+/// Decides which weapons fire as simulation time advances, keeping the weapons in a min-heap ordered by the time they fire next. Advancing
+/// only touches the weapons that are due, so a tick in which nothing fires costs the same however many weapons there are. Weapons due at
+/// the same time fire in the order they were scheduled.
+/// </summary>
+class WeaponScheduler
+{
+public:
+	/// <summary>
+	/// Initializes a scheduler with no weapons.
+	/// </summary>
+	WeaponScheduler();
+
+	~WeaponScheduler();
+
+	/// <summary>
+	/// Schedules a weapon to fire one firing period after the provided time, and every firing period after that.
+	/// </summary>
+	/// <param name="weapon">The id of the weapon, returned by popDue when it fires.</param>
+	/// <param name="firingPeriod">The time in microseconds between each time the weapon fires. Must be greater than 0.</param>
+	/// <param name="nowMicroseconds">The current simulation time in microseconds.</param>
+	void schedule(std::size_t weapon, sf::Int64 firingPeriod, sf::Int64 nowMicroseconds);
+
+	/// <summary>
+	/// Takes the next weapon due to fire at or before the provided time and schedules its following shot. Call until it returns false
+	/// to fire every due weapon in time order; a weapon whose period is shorter than the time advanced is returned more than once.
+	/// </summary>
+	/// <param name="nowMicroseconds">The current simulation time in microseconds.</param>
+	/// <param name="weapon">Set to the id of the weapon that fires.</param>
+	/// <returns>True if a weapon was due.</returns>
+	bool popDue(sf::Int64 nowMicroseconds, std::size_t& weapon);
+
+	/// <summary>
+	/// Gets the number of scheduled weapons.
+	/// </summary>
+	/// <returns>The number of scheduled weapons.</returns>
+	std::size_t size() const;
+
+private:
+	/// <summary>
+	/// The scheduled weapons, kept as a heap with the next to fire at the front.
+	/// </summary>
+	std::vector<ScheduledWeapon> heap;
+
+	/// <summary>
+	/// Orders the heap so the weapon firing soonest, then the one scheduled first, is at the front.
+	/// </summary>
+	/// <param name="a">The first weapon.</param>
+	/// <param name="b">The second weapon.</param>
+	/// <returns>True if a fires after b.</returns>
+	static bool firesAfter(const ScheduledWeapon& a, const ScheduledWeapon& b);
+};
+
+#endif // !WEAPON_SCHEDULER_H
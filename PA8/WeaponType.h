@@ -1,9 +1,14 @@
 #ifndef WEAPON_TYPE_H
 #define WEAPON_TYPE_H
 
+/// <summary>
+/// Enum representing the weapons the player can purchase. Basic weapons fire one projectile at a random enemy every two seconds. Seeking
+/// weapons fire a volley of two at the two enemies closest to the player's base every four seconds.
+/// </summary>
 enum class WeaponType
 {
-	Basic
+	Basic,
+	Seeking
 };
 #endif // !WEAPON_TYPE_H
 
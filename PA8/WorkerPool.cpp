@@ -0,0 +1,112 @@
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(unsigned int threadCount)
+{
+	threadCount = std::max(threadCount, 1u);
+	shares = new Share[threadCount];
+	body = nullptr;
+	invokeBody = nullptr;
+	itemCount = 0;
+	chunkSize = 1;
+	loopNumber = 0;
+	busyWorkers = 0;
+	isStopping = false;
+
+	for (unsigned int participant = 1; participant < threadCount; participant++)
+	{
+		workers.push_back(std::thread(&WorkerPool::work, this, participant));
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	loopStarted.notify_all();
+
+	for (std::size_t i = 0; i < workers.size(); i++)
+	{
+		workers[i].join();
+	}
+
+	delete[] shares;
+	shares = nullptr;
+}
+
+unsigned int WorkerPool::getThreadCount() const
+{
+	return (unsigned int)workers.size() + 1;
+}
+
+void WorkerPool::run(
+	std::size_t count,
+	std::size_t grain,
+	const void* loopBody,
+	void (*invokeLoopBody)(const void* loopBody, std::size_t begin, std::size_t end, unsigned int participant)
+	)
+{
+	unsigned int participants = getThreadCount();
+	std::size_t chunkCount = (count + grain - 1) / grain;
+	for (unsigned int i = 0; i < participants; i++)
+	{
+		shares[i].nextChunk = chunkCount * i / participants;
+		shares[i].endChunk = chunkCount * (i + 1) / participants;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		body = loopBody;
+		invokeBody = invokeLoopBody;
+		itemCount = count;
+		chunkSize = grain;
+		busyWorkers = (unsigned int)workers.size();
+		loopNumber++;
+	}
+	loopStarted.notify_all();
+
+	runChunks(0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	loopFinished.wait(lock, [this]() { return busyWorkers == 0; });
+	body = nullptr;
+}
+
+void WorkerPool::work(unsigned int participant)
+{
+	unsigned long lastLoop = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			loopStarted.wait(lock, [this, lastLoop]() { return isStopping || loopNumber != lastLoop; });
+			if (isStopping) return;
+
+			lastLoop = loopNumber;
+		}
+
+		runChunks(participant);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (--busyWorkers == 0)
+		{
+			loopFinished.notify_one();
+		}
+	}
+}
+
+void WorkerPool::runChunks(unsigned int participant)
+{
+	unsigned int participants = getThreadCount();
+	for (unsigned int offset = 0; offset < participants; offset++)
+	{
+		Share& share = shares[(participant + offset) % participants];
+		std::size_t chunk;
+		while ((chunk = share.nextChunk.fetch_add(1)) < share.endChunk)
+		{
+			std::size_t begin = chunk * chunkSize;
+			invokeBody(body, begin, std::min(begin + chunkSize, itemCount), participant);
+		}
+	}
+}
@@ -0,0 +1,176 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+
+/// <summary>
+/// A fixed set of worker threads that run data-parallel loops together with the calling thread. A loop is cut into chunks of a given
+/// size and every participating thread starts with an equal share of them. A thread that finishes its share steals the remaining chunks of
+/// the others, so uneven chunks do not leave threads idle. Loops no longer than one chunk run on the calling thread alone.
+/// </summary>
+class WorkerPool
+{
+public:
+	/// <summary>
+	/// Starts the worker threads.
+	/// </summary>
+	/// <param name="threadCount">The number of threads running each loop, including the calling thread. 0 or 1 runs every loop on the
+	/// calling thread.</param>
+	WorkerPool(unsigned int threadCount);
+
+	/// <summary>
+	/// Stops and joins the worker threads.
+	/// </summary>
+	~WorkerPool();
+
+	/// <summary>
+	/// Gets the number of threads running each loop, including the calling thread.
+	/// </summary>
+	/// <returns>The number of threads running each loop.</returns>
+	unsigned int getThreadCount() const;
+
+	/// <summary>
+	/// Calls the provided body on consecutive ranges covering 0 to count - 1 and returns once every range is done. Ranges may run at the
+	/// same time on different threads, so the body must only write to data belonging to its own range or to its participant.
+	/// </summary>
+	/// <param name="count">The number of items in the loop.</param>
+	/// <param name="grain">The most items in each range. Must be greater than 0.</param>
+	/// <param name="loopBody">The function called with the first item of a range, one past its last item, and the index of the participant
+	/// running it, from 0 to getThreadCount() - 1.</param>
+	template <typename Body>
+	void parallelFor(std::size_t count, std::size_t grain, const Body& loopBody)
+	{
+		if (count == 0) return;
+
+		if (workers.empty() || count <= grain)
+		{
+			loopBody(0, count, 0);
+			return;
+		}
+
+		run(count, grain, &loopBody, &invoke<Body>);
+	}
+
+private:
+	/// <summary>
+	/// The chunks of the current loop owned by one participant.
+	/// </summary>
+	struct Share
+	{
+		/// <summary>
+		/// The next chunk of this share to run. Claimed by the owner and by thieves alike.
+		/// </summary>
+		std::atomic<std::size_t> nextChunk;
+
+		/// <summary>
+		/// One past the last chunk of this share.
+		/// </summary>
+		std::size_t endChunk;
+	};
+
+	/// <summary>
+	/// The worker threads. Participant 0 is the calling thread, so worker i is participant i + 1.
+	/// </summary>
+	std::vector<std::thread> workers;
+
+	/// <summary>
+	/// The share of chunks of each participant in the current loop.
+	/// </summary>
+	Share* shares;
+
+	/// <summary>
+	/// The body of the current loop.
+	/// </summary>
+	const void* body;
+
+	/// <summary>
+	/// Calls the body of the current loop on one range.
+	/// </summary>
+	void (*invokeBody)(const void* loopBody, std::size_t begin, std::size_t end, unsigned int participant);
+
+	/// <summary>
+	/// The number of items in the current loop.
+	/// </summary>
+	std::size_t itemCount;
+
+	/// <summary>
+	/// The most items in each chunk of the current loop.
+	/// </summary>
+	std::size_t chunkSize;
+
+	/// <summary>
+	/// Incremented each time a loop starts, so the workers can tell a new loop from a spurious wake up.
+	/// </summary>
+	unsigned long loopNumber;
+
+	/// <summary>
+	/// The number of workers still running the current loop.
+	/// </summary>
+	unsigned int busyWorkers;
+
+	/// <summary>
+	/// Is true once the pool is being destroyed.
+	/// </summary>
+	bool isStopping;
+
+	/// <summary>
+	/// Guards the loop number, the busy worker count and the stopping flag.
+	/// </summary>
+	std::mutex mutex;
+
+	/// <summary>
+	/// Signalled when a loop starts or the pool stops.
+	/// </summary>
+	std::condition_variable loopStarted;
+
+	/// <summary>
+	/// Signalled when the last worker finishes a loop.
+	/// </summary>
+	std::condition_variable loopFinished;
+
+	/// <summary>
+	/// Calls a loop body of the provided type on one range.
+	/// </summary>
+	/// <param name="loopBody">The loop body.</param>
+	/// <param name="begin">The first item of the range.</param>
+	/// <param name="end">One past the last item of the range.</param>
+	/// <param name="participant">The index of the participant running the range.</param>
+	template <typename Body>
+	static void invoke(const void* loopBody, std::size_t begin, std::size_t end, unsigned int participant)
+	{
+		(*(const Body*)loopBody)(begin, end, participant);
+	}
+
+	/// <summary>
+	/// Splits a loop longer than one chunk between every participant and returns once it is done.
+	/// </summary>
+	/// <param name="count">The number of items in the loop.</param>
+	/// <param name="grain">The most items in each chunk.</param>
+	/// <param name="loopBody">The body of the loop.</param>
+	/// <param name="invokeLoopBody">Calls the body of the loop on one range.</param>
+	void run(
+		std::size_t count,
+		std::size_t grain,
+		const void* loopBody,
+		void (*invokeLoopBody)(const void* loopBody, std::size_t begin, std::size_t end, unsigned int participant)
+		);
+
+	/// <summary>
+	/// Waits for loops and runs its share of each until the pool stops.
+	/// </summary>
+	/// <param name="participant">The index of the participant this worker is.</param>
+	void work(unsigned int participant);
+
+	/// <summary>
+	/// Runs the chunks of the provided participant's share, then steals the chunks left in the other shares.
+	/// </summary>
+	/// <param name="participant">The index of the participant running the chunks.</param>
+	void runChunks(unsigned int participant);
+};
+
+#endif // !WORKER_POOL_H
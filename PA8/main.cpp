@@ -1,13 +1,47 @@
 #include <SFML/Graphics.hpp>
 #include <iostream>
+#include <string>
 #include "VideoHelpers.h"
 #include "ScreenManager.h"
+#include "HeadlessRunner.h"
+#include "FixedTimestep.h"
+#include "Profiler.h"
+#include "ProfilerOverlay.h"
 
 using namespace sf;
 using namespace std;
 
-int main()
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && string(argv[1]) == "--headless")
+    {
+        HeadlessRunner runner(argc - 1, argv + 1);
+        return runner.run();
+    }
+
+    // Simulation ticks per second, the most ticks run before a frame is drawn, and the most frames drawn per second (0 for no limit).
+    unsigned int tickRate = 60;
+    unsigned int maxTicksPerFrame = 5;
+    unsigned int frameLimit = 60;
+    // Where to write the per-section timings on exit. Profiling and the F3 overlay are off unless a path is given.
+    string profilePath;
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        string option = argv[i];
+        try
+        {
+            if (option == "--tick-rate") tickRate = stoul(argv[i + 1]);
+            else if (option == "--max-ticks-per-frame") maxTicksPerFrame = stoul(argv[i + 1]);
+            else if (option == "--frame-limit") frameLimit = stoul(argv[i + 1]);
+            else if (option == "--profile") profilePath = argv[i + 1];
+            else cout << "Unknown option " << option << endl;
+        }
+        catch (const exception& ex)
+        {
+            cout << "Invalid value for option " << option << ": " << ex.what() << endl;
+        }
+    }
+
     VideoMode fullscreenVideoMode;
     if (!VideoHelpers::getFullscreenVideoMode(fullscreenVideoMode))
     {
@@ -16,25 +50,58 @@ int main()
     }
 
     RenderWindow window(fullscreenVideoMode, "PA8", Style::Fullscreen);
-    ScreenManager screenManager(fullscreenVideoMode);
+    window.setFramerateLimit(frameLimit);
+    // Paces the menus and the swarm defense screen's sounds and game over checks. The match itself is stepped by the simulation thread of
+    // the swarm defense screen at the same tick rate, and drawn from the snapshots that thread publishes.
+    FixedTimestep timestep(tickRate, maxTicksPerFrame);
+    ScreenManager screenManager(fullscreenVideoMode, timestep.getTickMicroseconds());
+    Clock frameClock;
 
-   
+    Profiler& profiler = Profiler::getInstance();
+    profiler.setIsEnabled(!profilePath.empty());
+    ProfilerOverlay profilerOverlay(fullscreenVideoMode);
+    unsigned int frameSection = profiler.registerSection("frame");
+    unsigned int updateSection = profiler.registerSection("update");
+    unsigned int eventsSection = profiler.registerSection("events");
+    unsigned int drawSection = profiler.registerSection("draw");
+    unsigned int displaySection = profiler.registerSection("display");
 
     while (window.isOpen())
     {
-        screenManager.updateState();
-        if (screenManager.shouldExitGame())
+        ProfileScope frameScope(frameSection);
+        unsigned int ticks = timestep.advance(frameClock.restart().asMicroseconds());
+        for (unsigned int tick = 0; tick < ticks && window.isOpen(); tick++)
+        {
+            ProfileScope updateScope(updateSection);
+            screenManager.updateState();
+            if (screenManager.shouldExitGame()) window.close();
+        }
+
+        if (!window.isOpen()) break;
+
+        {
+            ProfileScope eventsScope(eventsSection);
+            screenManager.getCurrentScreen()->handleEvents(window);
+        }
+
+        if (profiler.getIsEnabled())
+        {
+            profilerOverlay.processKeyboardInput();
+            profilerOverlay.updateState();
+        }
+
         {
-            window.close();
-            return EXIT_SUCCESS;
+            ProfileScope drawScope(drawSection);
+            window.clear();
+            screenManager.drawTo(window);
+            profilerOverlay.drawTo(window);
         }
 
-        screenManager.getCurrentScreen()->handleEvents(window);
-        window.clear();
-        screenManager.drawTo(window);
+        ProfileScope displayScope(displaySection);
         window.display();
     }
 
+    if (!profilePath.empty()) profiler.writeCsv(profilePath);
 
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
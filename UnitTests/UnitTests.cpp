@@ -1,6 +1,23 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "MoveableRectangle.cpp"
+#include "RandomStream.cpp"
+#include "WorkerPool.cpp"
+#include "EnemyStore.cpp"
+#include "EnemyGrid.cpp"
+#include "MovementKernel.cpp"
+#include "FixedTimestep.cpp"
+#include "SpriteBatch.cpp"
+#include "TextureAtlas.cpp"
+#include "FontAtlas.cpp"
+#include "ResourceCache.cpp"
+#include "HudCounter.cpp"
+#include "AssetLoader.cpp"
+#include "Profiler.cpp"
+#include "Projectile.cpp"
+#include "ProjectilePool.cpp"
+#include "WeaponScheduler.cpp"
+#include "TripleBuffer.h"
 #include <SFML/Graphics.hpp>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -157,4 +174,935 @@ namespace UnitTests
 			Assert::AreEqual(testRectangle.getCenterCoordinates().y, (float)13);
 		}
 	};
-}
+
+	TEST_CLASS(AABBTests)
+	{
+	public:
+
+		TEST_METHOD(TouchingBoxesOverlapTrue)
+		{
+			AABB leftBox = AABB::fromCenter(sf::Vector2f(100.0f, 100.0f), sf::Vector2f(10.0f, 10.0f));
+			AABB rightBox = AABB::fromCenter(sf::Vector2f(110.0f, 100.0f), sf::Vector2f(10.0f, 10.0f));
+			Assert::IsTrue(leftBox.overlaps(rightBox));
+			Assert::IsTrue(rightBox.overlaps(leftBox));
+		}
+
+		TEST_METHOD(SeparatedBoxesOverlapFalse)
+		{
+			AABB topBox = AABB::fromCenter(sf::Vector2f(100.0f, 100.0f), sf::Vector2f(10.0f, 10.0f));
+			AABB bottomBox = AABB::fromCenter(sf::Vector2f(100.0f, 110.01f), sf::Vector2f(10.0f, 10.0f));
+			Assert::IsFalse(topBox.overlaps(bottomBox));
+			Assert::IsFalse(bottomBox.overlaps(topBox));
+		}
+
+		TEST_METHOD(BatchedOverlapsMatchesSingleOverlapsFor100Boxes)
+		{
+			std::vector<AABB> boxes;
+			for (int i = 0; i < 100; i++)
+			{
+				boxes.push_back(AABB::fromCenter(sf::Vector2f(i * 7.0f, (i % 10) * 11.0f), sf::Vector2f(10.0f, 10.0f)));
+			}
+			AABB other = AABB::fromCenter(sf::Vector2f(300.0f, 40.0f), sf::Vector2f(60.0f, 30.0f));
+			std::vector<sf::Uint64> mask;
+			AABB::overlaps(boxes.data(), boxes.size(), other, mask);
+			Assert::AreEqual(mask.size(), (std::size_t)2);
+			for (std::size_t i = 0; i < boxes.size(); i++)
+			{
+				Assert::AreEqual(((mask[i / 64] >> (i % 64)) & 1) == 1, boxes[i].overlaps(other));
+			}
+		}
+	};
+
+	TEST_CLASS(EnemyStoreTests)
+	{
+	public:
+
+		TEST_METHOD(DestroyedEnemyHandleIsNoLongerContained)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			EnemyHandle handle = store.spawn(sf::VideoMode(1000, 1000), random);
+			Assert::IsTrue(store.contains(handle));
+			Assert::IsTrue(store.destroy(handle));
+			Assert::IsFalse(store.contains(handle));
+			Assert::IsTrue(store.empty());
+		}
+
+		TEST_METHOD(DestroyingStaleHandleTwiceReturnsFalse)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			EnemyHandle handle = store.spawn(sf::VideoMode(1000, 1000), random);
+			store.spawn(sf::VideoMode(1000, 1000), random);
+			Assert::IsTrue(store.destroy(handle));
+			Assert::IsFalse(store.destroy(handle));
+			Assert::AreEqual(store.size(), (std::size_t)1);
+		}
+
+		TEST_METHOD(ReusedSlotDoesNotMatchStaleHandle)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			EnemyHandle oldHandle = store.spawn(sf::VideoMode(1000, 1000), random);
+			store.destroy(oldHandle);
+			EnemyHandle newHandle = store.spawn(sf::VideoMode(1000, 1000), random);
+			Assert::AreEqual(newHandle.slot, oldHandle.slot);
+			Assert::IsFalse(store.contains(oldHandle));
+			Assert::IsTrue(store.contains(newHandle));
+		}
+
+		TEST_METHOD(DestroyingFirstEnemyKeepsOtherHandlesValid)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			EnemyHandle first = store.spawn(sf::VideoMode(1000, 1000), random);
+			EnemyHandle second = store.spawn(sf::VideoMode(1000, 1000), random);
+			EnemyHandle third = store.spawn(sf::VideoMode(1000, 1000), random);
+			sf::Vector2f thirdPosition = store.getCenterCoordinates(2);
+			store.destroy(first);
+			std::size_t index;
+			Assert::IsTrue(store.findIndex(third, index));
+			Assert::AreEqual(store.getHandle(index).slot, third.slot);
+			Assert::AreEqual(store.getCenterCoordinates(index).x, thirdPosition.x);
+			Assert::IsTrue(store.contains(second));
+		}
+
+		TEST_METHOD(DyingAndDestroyedEnemiesAreNotTargetable)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			EnemyHandle first = store.spawn(sf::VideoMode(1000, 1000), random);
+			EnemyHandle second = store.spawn(sf::VideoMode(1000, 1000), random);
+			EnemyHandle third = store.spawn(sf::VideoMode(1000, 1000), random);
+			std::size_t index;
+			Assert::IsTrue(store.findIndex(first, index));
+			store.die(index);
+			store.die(index);
+			store.destroy(third);
+
+			Assert::AreEqual(store.getTargetableCount(), (std::size_t)1);
+			Assert::AreEqual(store.getHandle(store.getTargetableIndex(0)).slot, second.slot);
+			Assert::IsTrue(store.findClosestTarget(index));
+			Assert::AreEqual(store.getHandle(index).slot, second.slot);
+
+			Assert::IsTrue(store.findIndex(second, index));
+			store.die(index);
+			Assert::AreEqual(store.getTargetableCount(), (std::size_t)0);
+			Assert::IsFalse(store.findClosestTarget(index));
+		}
+
+		TEST_METHOD(ClosestTargetIsNearestToScreenCenter)
+		{
+			sf::VideoMode testVideoMode = sf::VideoMode(1000, 1000);
+			EnemyStore store;
+			RandomStream random(3, RandomSubsystem::Spawning);
+			for (int spawned = 0; spawned < 50; spawned++)
+			{
+				store.spawn(testVideoMode, random);
+				store.advanceTowards(500.0f, 500.0f, 7.0f);
+			}
+
+			std::size_t closest;
+			Assert::IsTrue(store.findClosestTarget(closest));
+			sf::Vector2f closestPosition = store.getCenterCoordinates(closest);
+			float closestDistance = std::hypot(closestPosition.x - 500.0f, closestPosition.y - 500.0f);
+			for (std::size_t i = 0; i < store.size(); i++)
+			{
+				sf::Vector2f position = store.getCenterCoordinates(i);
+				Assert::IsTrue(closestDistance <= std::hypot(position.x - 500.0f, position.y - 500.0f) + 0.01f);
+			}
+		}
+
+		TEST_METHOD(ClosestTargetsAreOrderedByDistanceToScreenCenter)
+		{
+			sf::VideoMode testVideoMode = sf::VideoMode(1000, 1000);
+			EnemyStore store;
+			RandomStream random(5, RandomSubsystem::Spawning);
+			for (int spawned = 0; spawned < 30; spawned++)
+			{
+				store.spawn(testVideoMode, random);
+				store.advanceTowards(500.0f, 500.0f, 11.0f);
+			}
+			store.die(0);
+
+			std::vector<std::size_t> closest;
+			Assert::AreEqual(store.findClosestTargets(5, closest), (std::size_t)5);
+			float previousDistance = 0.0f;
+			for (std::size_t i = 0; i < closest.size(); i++)
+			{
+				Assert::IsFalse(store.hasFlag(closest[i], EnemyFlag::IsDying));
+				sf::Vector2f position = store.getCenterCoordinates(closest[i]);
+				float distance = std::hypot(position.x - 500.0f, position.y - 500.0f);
+				Assert::IsTrue(distance + 0.01f >= previousDistance);
+				previousDistance = distance;
+			}
+
+			closest.clear();
+			Assert::AreEqual(store.findClosestTargets(100, closest), (std::size_t)29);
+		}
+
+		TEST_METHOD(DyingEnemyResizesOnceThenPlaysDeathFrames)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			store.spawn(sf::VideoMode(1000, 1000), random);
+			sf::Vector2f baseDimensions = EnemyStore::getBaseDimensions(sf::VideoMode(1000, 1000));
+			std::vector<GhostSnapshot> ghosts;
+
+			store.die(0);
+			store.advanceAnimations(200001);
+			store.writeSnapshots(ghosts);
+			Assert::IsTrue(ghosts[0].animation == GhostAnimation::Death1);
+			Assert::AreEqual(ghosts[0].size.x, baseDimensions.x * 0.85f);
+			Assert::AreEqual(ghosts[0].size.y, baseDimensions.y * 1.2f);
+
+			for (int frame = 0; frame < 4; frame++)
+			{
+				store.advanceAnimations(200000);
+			}
+			store.writeSnapshots(ghosts);
+			Assert::IsTrue(ghosts[0].animation == GhostAnimation::Death5);
+			Assert::AreEqual(ghosts[0].size.x, baseDimensions.x * 0.85f);
+			Assert::IsFalse(store.hasFlag(0, EnemyFlag::IsDead));
+
+			store.advanceAnimations(200000);
+			store.writeSnapshots(ghosts);
+			Assert::IsTrue(ghosts[0].animation == GhostAnimation::Death5);
+			Assert::IsTrue(store.hasFlag(0, EnemyFlag::IsDead));
+		}
+
+		TEST_METHOD(AttackingEnemyLandsAttackAfterSevenFrames)
+		{
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			store.spawn(sf::VideoMode(1000, 1000), random);
+			std::vector<GhostSnapshot> ghosts;
+
+			store.attack(0);
+			for (int frame = 0; frame < 7; frame++)
+			{
+				store.advanceAnimations(200001);
+				Assert::IsFalse(store.hasFlag(0, EnemyFlag::DidAttack));
+			}
+			store.writeSnapshots(ghosts);
+			Assert::IsTrue(ghosts[0].animation == GhostAnimation::Attack7);
+
+			store.advanceAnimations(200001);
+			store.writeSnapshots(ghosts);
+			Assert::IsTrue(ghosts[0].animation == GhostAnimation::Death1);
+			Assert::IsTrue(store.hasFlag(0, EnemyFlag::DidAttack));
+		}
+	};
+
+	TEST_CLASS(EnemyGridTests)
+	{
+	public:
+
+		TEST_METHOD(QueryAtEnemyCenterReturnsEnemy)
+		{
+			sf::VideoMode testVideoMode = sf::VideoMode(1000, 1000);
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			store.spawn(testVideoMode, random);
+			store.spawn(testVideoMode, random);
+			EnemyGrid grid;
+			grid.configure(testVideoMode, 50.0f);
+			grid.rebuild(store);
+			std::vector<sf::Uint32> candidates;
+			grid.query(AABB::fromCenter(store.getCenterCoordinates(1), sf::Vector2f(1.0f, 1.0f)), candidates);
+			Assert::IsTrue(std::find(candidates.begin(), candidates.end(), (sf::Uint32)1) != candidates.end());
+		}
+
+		TEST_METHOD(QueryAtScreenCenterMissesSpawnedEnemies)
+		{
+			sf::VideoMode testVideoMode = sf::VideoMode(1000, 1000);
+			EnemyStore store;
+			RandomStream random(1, RandomSubsystem::Spawning);
+			for (int i = 0; i < 20; i++) store.spawn(testVideoMode, random);
+			EnemyGrid grid;
+			grid.configure(testVideoMode, 50.0f);
+			grid.rebuild(store);
+			std::vector<sf::Uint32> candidates;
+			grid.query(AABB::fromCenter(sf::Vector2f(500.0f, 500.0f), sf::Vector2f(10.0f, 10.0f)), candidates);
+			Assert::IsTrue(candidates.empty());
+		}
+	};
+
+	TEST_CLASS(MovementKernelTests)
+	{
+	public:
+
+		TEST_METHOD(AdvanceTowardsMatchesShiftTowardsTrajectories)
+		{
+			const int count = 37;
+			std::vector<MoveableRectangle> rectangles;
+			std::vector<float> positionX;
+			std::vector<float> positionY;
+			std::vector<unsigned char> flags(count, 0);
+			for (int i = 0; i < count; i++)
+			{
+				float angle = i * 0.17f;
+				rectangles.push_back(MoveableRectangle(sf::Vector2f(10.0f, 10.0f)));
+				rectangles.back().moveTo(500.0f + std::cos(angle) * (100.0f + i * 20.0f), 400.0f + std::sin(angle) * (100.0f + i * 20.0f));
+				positionX.push_back(rectangles.back().getCenterCoordinates().x);
+				positionY.push_back(rectangles.back().getCenterCoordinates().y);
+			}
+
+			for (int step = 0; step < 200; step++)
+			{
+				MovementKernel::advanceTowards(positionX.data(), positionY.data(), flags.data(), 1, count, 500.0f, 400.0f, 3.5f);
+				for (int i = 0; i < count; i++)
+				{
+					rectangles[i].shiftTowards(500.0f, 400.0f, 3.5f);
+					Assert::AreEqual(positionX[i], rectangles[i].getCenterCoordinates().x, 0.05f);
+					Assert::AreEqual(positionY[i], rectangles[i].getCenterCoordinates().y, 0.05f);
+				}
+			}
+		}
+
+		TEST_METHOD(AdvanceTowardsSkipsFlaggedPositionsAndMatchesScalar)
+		{
+			const int count = 21;
+			std::vector<float> positionX;
+			std::vector<float> positionY;
+			std::vector<unsigned char> flags;
+			for (int i = 0; i < count; i++)
+			{
+				positionX.push_back(i * 50.0f);
+				positionY.push_back(1000.0f - i * 30.0f);
+				flags.push_back(i % 3 == 0 ? 4 : 2);
+			}
+			std::vector<float> scalarX = positionX;
+			std::vector<float> scalarY = positionY;
+
+			MovementKernel::advanceTowards(positionX.data(), positionY.data(), flags.data(), 4, count, 500.0f, 500.0f, 40.0f);
+			MovementKernel::advanceTowardsScalar(scalarX.data(), scalarY.data(), flags.data(), 4, count, 500.0f, 500.0f, 40.0f);
+			for (int i = 0; i < count; i++)
+			{
+				Assert::AreEqual(positionX[i], scalarX[i], 0.001f);
+				Assert::AreEqual(positionY[i], scalarY[i], 0.001f);
+				if (i % 3 == 0)
+				{
+					Assert::AreEqual(positionX[i], i * 50.0f);
+					Assert::AreEqual(positionY[i], 1000.0f - i * 30.0f);
+				}
+			}
+		}
+
+		TEST_METHOD(AdvanceTowardsPastTargetStopsOnTarget)
+		{
+			float positionX[] = { 10.0f, 50.0f };
+			float positionY[] = { 10.0f, 60.0f };
+			unsigned char flags[] = { 0, 0 };
+			MovementKernel::advanceTowards(positionX, positionY, flags, 1, 2, 12.0f, 9.0f, 100.0f);
+			Assert::AreEqual(positionX[0], 12.0f);
+			Assert::AreEqual(positionY[0], 9.0f);
+			Assert::AreEqual(positionX[1], 12.0f);
+			Assert::AreEqual(positionY[1], 9.0f);
+		}
+	};
+
+	TEST_CLASS(FixedTimestepTests)
+	{
+	public:
+
+		TEST_METHOD(AdvanceTwoAndAHalfTicksRunsTwoTicksWithHalfInterpolation)
+		{
+			FixedTimestep timestep(100, 5);
+			Assert::AreEqual(timestep.advance(25000), 2u);
+			Assert::AreEqual(timestep.getInterpolation(), 0.5f, 0.0001f);
+			Assert::AreEqual(timestep.advance(5000), 1u);
+			Assert::AreEqual(timestep.getInterpolation(), 0.0f, 0.0001f);
+		}
+
+		TEST_METHOD(AdvanceShorterThanATickRunsNoTicks)
+		{
+			FixedTimestep timestep(100, 5);
+			Assert::AreEqual(timestep.advance(4000), 0u);
+			Assert::AreEqual(timestep.advance(4000), 0u);
+			Assert::AreEqual(timestep.advance(4000), 1u);
+		}
+
+		TEST_METHOD(AdvancePastCapRunsCapAndDropsTheRest)
+		{
+			FixedTimestep timestep(100, 5);
+			Assert::AreEqual(timestep.advance(1000000), 5u);
+			Assert::AreEqual(timestep.getInterpolation(), 0.0f, 0.0001f);
+			Assert::IsTrue(timestep.getDroppedMicroseconds() == 950000);
+			Assert::AreEqual(timestep.advance(10000), 1u);
+		}
+	};
+
+	TEST_CLASS(SpriteBatchTests)
+	{
+	public:
+
+		TEST_METHOD(AddedQuadMatchesRectangleShapePlacement)
+		{
+			SpriteBatch batch;
+			batch.add(sf::Vector2f(100.0f, 50.0f), sf::Vector2f(40.0f, 20.0f), sf::Vector2f(20.0f, 10.0f), sf::IntRect(5, 6, 38, 37), false);
+			const sf::VertexArray& vertices = batch.getVertices();
+			Assert::IsTrue(batch.getSpriteCount() == 1);
+			Assert::AreEqual(vertices[0].position.x, 80.0f);
+			Assert::AreEqual(vertices[0].position.y, 40.0f);
+			Assert::AreEqual(vertices[2].position.x, 120.0f);
+			Assert::AreEqual(vertices[2].position.y, 60.0f);
+			Assert::AreEqual(vertices[0].texCoords.x, 5.0f);
+			Assert::AreEqual(vertices[2].texCoords.y, 43.0f);
+		}
+
+		TEST_METHOD(MirroredQuadFlipsAroundOrigin)
+		{
+			SpriteBatch batch;
+			batch.add(sf::Vector2f(100.0f, 50.0f), sf::Vector2f(40.0f, 20.0f), sf::Vector2f(10.0f, 10.0f), sf::IntRect(0, 0, 40, 20), true);
+			const sf::VertexArray& vertices = batch.getVertices();
+			Assert::AreEqual(vertices[0].position.x, 110.0f);
+			Assert::AreEqual(vertices[1].position.x, 70.0f);
+			Assert::AreEqual(vertices[0].texCoords.x, 0.0f);
+			Assert::AreEqual(vertices[1].texCoords.x, 40.0f);
+		}
+	};
+
+	TEST_CLASS(TextureAtlasTests)
+	{
+	public:
+
+		TEST_METHOD(PackedRectsDoNotOverlapAndFitPackedSize)
+		{
+			std::vector<sf::Vector2u> sizes;
+			for (unsigned int i = 0; i < 30; i++)
+			{
+				sizes.push_back(sf::Vector2u(10 + (i * 7) % 40, 5 + (i * 11) % 30));
+			}
+
+			std::vector<sf::IntRect> rects;
+			sf::Vector2u packedSize = TextureAtlas::pack(sizes, 128, rects);
+			for (std::size_t i = 0; i < rects.size(); i++)
+			{
+				Assert::IsTrue(rects[i].width == (int)sizes[i].x && rects[i].height == (int)sizes[i].y);
+				Assert::IsTrue(rects[i].left + rects[i].width <= (int)packedSize.x);
+				Assert::IsTrue(rects[i].top + rects[i].height <= (int)packedSize.y);
+				Assert::IsTrue(packedSize.x <= 128);
+				for (std::size_t j = i + 1; j < rects.size(); j++)
+				{
+					bool isSeparated = rects[i].left + rects[i].width < rects[j].left || rects[j].left + rects[j].width < rects[i].left
+						|| rects[i].top + rects[i].height < rects[j].top || rects[j].top + rects[j].height < rects[i].top;
+					Assert::IsTrue(isSeparated);
+				}
+			}
+		}
+
+		TEST_METHOD(ReadSpecPrefixesImagesWithSpecDirectory)
+		{
+			const std::string specPath = "TextureAtlasTestsSpec.txt";
+			std::ofstream spec(specPath);
+			spec << "# comment" << std::endl << "gui a.png b.png" << std::endl << std::endl << "sprites c.png" << std::endl;
+			spec.close();
+
+			std::map<std::string, std::vector<std::string>> atlases;
+			Assert::IsTrue(TextureAtlas::readSpec(specPath, atlases));
+			std::remove(specPath.c_str());
+			Assert::IsTrue(atlases.size() == 2);
+			Assert::IsTrue(atlases["gui"].size() == 2);
+			Assert::AreEqual(atlases["gui"][1], std::string("b.png"));
+			Assert::AreEqual(atlases["sprites"][0], std::string("c.png"));
+			Assert::AreEqual(TextureAtlas::getDirectory("assets/atlases.txt"), std::string("assets/"));
+		}
+
+		TEST_METHOD(NameFromPathDropsDirectoryAndExtension)
+		{
+			Assert::AreEqual(TextureAtlas::getNameFromPath("assets/ghostTailUp.png"), std::string("ghostTailUp"));
+			Assert::AreEqual(TextureAtlas::getNameFromPath("assets\\castle.png"), std::string("castle"));
+			Assert::AreEqual(TextureAtlas::getNameFromPath("gear_icon"), std::string("gear_icon"));
+		}
+	};
+
+	TEST_CLASS(ResourceCacheTests)
+	{
+	public:
+
+		TEST_METHOD(SecondRequestForSamePathSharesFirstResource)
+		{
+			ResourceCache& cache = ResourceCache::getInstance();
+			ResourceCacheStats before = cache.getStats();
+			std::shared_ptr<const FontAtlas> first = cache.getFontAtlas("ResourceCacheTestsSharedFont.ttf");
+			std::shared_ptr<const FontAtlas> second = cache.getFontAtlas("ResourceCacheTestsSharedFont.ttf");
+			ResourceCacheStats after = cache.getStats();
+			Assert::IsTrue(first == second);
+			Assert::IsTrue(after.loads == before.loads + 1);
+			Assert::IsTrue(after.hits == before.hits + 1);
+		}
+
+		TEST_METHOD(EvictUnusedKeepsResourcesStillInUse)
+		{
+			ResourceCache& cache = ResourceCache::getInstance();
+			std::shared_ptr<const sf::SoundBuffer> kept = cache.getSoundBuffer("ResourceCacheTestsKept.wav");
+			cache.getSoundBuffer("ResourceCacheTestsReleased.wav");
+			cache.evictUnused();
+
+			ResourceCacheStats before = cache.getStats();
+			Assert::IsTrue(cache.getSoundBuffer("ResourceCacheTestsKept.wav") == kept);
+			cache.getSoundBuffer("ResourceCacheTestsReleased.wav");
+			ResourceCacheStats after = cache.getStats();
+			Assert::IsTrue(after.hits == before.hits + 1);
+			Assert::IsTrue(after.loads == before.loads + 1);
+		}
+	};
+
+	TEST_CLASS(AssetLoaderTests)
+	{
+	public:
+
+		TEST_METHOD(LoaderWithNoRequestsIsDone)
+		{
+			AssetLoader loader;
+			loader.start();
+			Assert::IsTrue(loader.getIsDone());
+			Assert::AreEqual(loader.getProgress(), 1.0f);
+		}
+
+		TEST_METHOD(FinalizedAssetsAreCachedAndSkippedByLaterLoaders)
+		{
+			AssetLoader loader;
+			loader.requestSoundBuffer("AssetLoaderTestsSound.wav");
+			loader.requestTextureAtlas("AssetLoaderTestsMissingSpec.txt", "sprites");
+			loader.start(2);
+			Assert::IsTrue(loader.getProgress() < 1.0f);
+
+			while (!loader.getIsDone())
+			{
+				loader.finalize(1);
+				std::this_thread::yield();
+			}
+
+			ResourceCache& cache = ResourceCache::getInstance();
+			Assert::IsTrue(cache.hasSoundBuffer("AssetLoaderTestsSound.wav"));
+			Assert::IsTrue(cache.hasTextureAtlas("AssetLoaderTestsMissingSpec.txt", "sprites"));
+
+			AssetLoader laterLoader;
+			laterLoader.requestSoundBuffer("AssetLoaderTestsSound.wav");
+			laterLoader.requestTextureAtlas("AssetLoaderTestsMissingSpec.txt", "sprites");
+			Assert::IsTrue(laterLoader.getIsDone());
+		}
+	};
+
+	TEST_CLASS(ProfilerTests)
+	{
+	public:
+
+		TEST_METHOD(SummaryGivesPercentilesOfRecentSamples)
+		{
+			Profiler& profiler = Profiler::getInstance();
+			unsigned int section = profiler.registerSection("ProfilerTestsPercentiles");
+			Assert::AreEqual(profiler.registerSection("ProfilerTestsPercentiles"), section);
+
+			profiler.setIsEnabled(true);
+			profiler.reset();
+			for (sf::Int64 microseconds = 1; microseconds <= 100; microseconds++)
+			{
+				profiler.record(section, microseconds);
+			}
+			profiler.record(section, 1000);
+			profiler.setIsEnabled(false);
+			profiler.record(section, 5000);
+
+			std::vector<ProfileSummary> all = profiler.summarize();
+			Assert::AreEqual(all.size(), (std::size_t)1);
+			Assert::AreEqual(all[0].count, (std::size_t)101);
+			Assert::IsTrue(all[0].p50Microseconds == 51);
+			Assert::IsTrue(all[0].p99Microseconds == 100);
+			Assert::IsTrue(all[0].maxMicroseconds == 1000);
+
+			std::vector<ProfileSummary> recent = profiler.summarize(2);
+			Assert::IsTrue(recent[0].p50Microseconds == 1000);
+		}
+
+		TEST_METHOD(CountersKeepTheirLatestValueWhileEnabled)
+		{
+			Profiler& profiler = Profiler::getInstance();
+			unsigned int counter = profiler.registerCounter("ProfilerTestsCounter");
+			Assert::AreEqual(profiler.registerCounter("ProfilerTestsCounter"), counter);
+
+			profiler.setIsEnabled(true);
+			profiler.reset();
+			Assert::IsTrue(profiler.getCounters().empty());
+			profiler.setCounter(counter, 12);
+			profiler.setCounter(counter, 7);
+			profiler.setIsEnabled(false);
+			profiler.setCounter(counter, 99);
+
+			std::vector<ProfileCounter> counters = profiler.getCounters();
+			Assert::AreEqual(counters.size(), (std::size_t)1);
+			Assert::IsTrue(counters[0].name == "ProfilerTestsCounter");
+			Assert::IsTrue(counters[0].value == 7);
+		}
+	};
+
+	TEST_CLASS(ProjectilePoolTests)
+	{
+	public:
+
+		TEST_METHOD(ReleasedProjectilesAreRecycledWithoutAllocating)
+		{
+			ProjectilePool pool;
+			pool.configure(sf::VideoMode(800, 600), 4);
+			for (int shot = 0; shot < 100; shot++)
+			{
+				Projectile* projectile = pool.acquire(10.0f, 20.0f);
+				Assert::IsTrue(projectile != nullptr);
+				projectile->shiftTowards(10.0f, 20.0f, 50.0f);
+				projectile->hit();
+				pool.release(0);
+			}
+
+			ProjectilePoolStats stats = pool.getStats();
+			Assert::AreEqual(stats.allocations, 1ul);
+			Assert::AreEqual(stats.acquisitions, 100ul);
+			Assert::AreEqual(stats.releases, 100ul);
+			Assert::IsTrue(pool.empty());
+
+			Projectile* recycled = pool.acquire(30.0f, 40.0f);
+			Assert::IsFalse(recycled->getHasHit());
+			Assert::AreEqual(recycled->getCenterCoordinates().x, 400.0f, 0.001f);
+			Assert::AreEqual(recycled->getCenterCoordinates().y, 300.0f, 0.001f);
+			Assert::AreEqual(recycled->getxDest(), 30.0f, 0.001f);
+		}
+
+		TEST_METHOD(FullPoolRejectsAndReleaseKeepsOthersInFlight)
+		{
+			ProjectilePool pool;
+			pool.configure(sf::VideoMode(800, 600), 3);
+			pool.acquire(1.0f, 0.0f);
+			pool.acquire(2.0f, 0.0f);
+			pool.acquire(3.0f, 0.0f);
+			Assert::IsTrue(pool.acquire(4.0f, 0.0f) == nullptr);
+			Assert::AreEqual(pool.getStats().rejections, 1ul);
+
+			pool.release(0);
+			Assert::AreEqual(pool.size(), (std::size_t)2);
+			Assert::AreEqual(pool[0].getxDest(), 3.0f, 0.001f);
+			Assert::AreEqual(pool[1].getxDest(), 2.0f, 0.001f);
+
+			Assert::IsTrue(pool.acquire(5.0f, 0.0f) != nullptr);
+			Assert::AreEqual(pool.getStats().allocations, 3ul);
+			Assert::AreEqual(pool.getStats().peakActive, (std::size_t)3);
+		}
+
+		TEST_METHOD(PoolGrowsPastOneChunkWithoutMovingProjectiles)
+		{
+			ProjectilePool pool;
+			pool.configure(sf::VideoMode(800, 600), 1000);
+			Projectile* first = pool.acquire(1.0f, 0.0f);
+			for (int shot = 1; shot < 600; shot++)
+			{
+				Assert::IsTrue(pool.acquire((float)shot, 0.0f) != nullptr);
+			}
+
+			Assert::IsTrue(first == &pool[0]);
+			Assert::AreEqual(first->getxDest(), 1.0f, 0.001f);
+			Assert::AreEqual(pool[599].getxDest(), 599.0f, 0.001f);
+			Assert::AreEqual(pool.getStats().allocations, 600ul);
+		}
+	};
+
+	TEST_CLASS(ProjectileTests)
+	{
+	public:
+
+		TEST_METHOD(ProjectileArrivesAtItsDestination)
+		{
+			Projectile projectile(sf::VideoMode(800, 600), 0, 400.0f, 100.0f);
+			Assert::IsFalse(projectile.getDidArrive());
+			projectile.shiftTowards(projectile.getxDest(), projectile.getyDest(), 150.0f);
+			Assert::IsFalse(projectile.getDidArrive());
+			projectile.shiftTowards(projectile.getxDest(), projectile.getyDest(), 150.0f);
+			Assert::IsTrue(projectile.getDidArrive());
+		}
+
+		TEST_METHOD(ProjectileExpiresAfterItsLifetimeUntilReset)
+		{
+			sf::VideoMode videoMode(800, 600);
+			Projectile projectile(videoMode, 0, 0.0f, 0.0f);
+			projectile.age(3999999);
+			Assert::IsFalse(projectile.getIsExpired());
+			projectile.age(1);
+			Assert::IsTrue(projectile.getIsExpired());
+
+			projectile.reset(videoMode, 0, 0.0f, 0.0f);
+			Assert::IsFalse(projectile.getIsExpired());
+		}
+	};
+
+	TEST_CLASS(RandomStreamTests)
+	{
+	public:
+
+		TEST_METHOD(SameSeedAndSubsystemRepeatTheSameSequence)
+		{
+			RandomStream first(42, RandomSubsystem::Spawning);
+			RandomStream second(42, RandomSubsystem::Spawning);
+			RandomStream otherSubsystem(42, RandomSubsystem::Targeting);
+			bool didDiffer = false;
+			for (int i = 0; i < 100; i++)
+			{
+				sf::Uint32 value = first.next();
+				Assert::AreEqual(second.next(), value);
+				if (otherSubsystem.next() != value) didDiffer = true;
+			}
+			Assert::IsTrue(didDiffer);
+		}
+
+		TEST_METHOD(DrawsStayInRange)
+		{
+			RandomStream random(7, RandomSubsystem::Targeting);
+			bool didDraw[3] = { false, false, false };
+			for (int i = 0; i < 1000; i++)
+			{
+				float percent = random.nextFloat();
+				Assert::IsTrue(percent >= 0.0f && percent < 1.0f);
+
+				sf::Uint32 index = random.nextIndex(3);
+				Assert::IsTrue(index < 3);
+				didDraw[index] = true;
+			}
+			Assert::IsTrue(didDraw[0] && didDraw[1] && didDraw[2]);
+			Assert::AreEqual(random.nextIndex(1), (sf::Uint32)0);
+		}
+	};
+
+	TEST_CLASS(WeaponSchedulerTests)
+	{
+	public:
+
+		TEST_METHOD(OnlyDueWeaponsFireInTimeOrder)
+		{
+			WeaponScheduler scheduler;
+			scheduler.schedule(0, 300, 0);
+			scheduler.schedule(1, 100, 0);
+			scheduler.schedule(2, 200, 50);
+
+			std::size_t weapon;
+			Assert::IsFalse(scheduler.popDue(99, weapon));
+			Assert::IsTrue(scheduler.popDue(100, weapon));
+			Assert::AreEqual(weapon, (std::size_t)1);
+			Assert::IsFalse(scheduler.popDue(100, weapon));
+
+			Assert::IsTrue(scheduler.popDue(300, weapon));
+			Assert::AreEqual(weapon, (std::size_t)1);
+			Assert::IsTrue(scheduler.popDue(300, weapon));
+			Assert::AreEqual(weapon, (std::size_t)2);
+			Assert::IsTrue(scheduler.popDue(300, weapon));
+			Assert::AreEqual(weapon, (std::size_t)0);
+			Assert::IsTrue(scheduler.popDue(300, weapon));
+			Assert::AreEqual(weapon, (std::size_t)1);
+			Assert::IsFalse(scheduler.popDue(300, weapon));
+			Assert::AreEqual(scheduler.size(), (std::size_t)3);
+		}
+
+		TEST_METHOD(LongTickFiresAWeaponOncePerPeriod)
+		{
+			WeaponScheduler scheduler;
+			scheduler.schedule(7, 16667, 0);
+
+			int fires = 0;
+			std::size_t weapon;
+			while (scheduler.popDue(100000, weapon))
+			{
+				Assert::AreEqual(weapon, (std::size_t)7);
+				fires++;
+			}
+			Assert::AreEqual(fires, 5);
+		}
+	};
+
+	TEST_CLASS(WorkerPoolTests)
+	{
+	public:
+
+		TEST_METHOD(ParallelForCoversEveryItemOnce)
+		{
+			WorkerPool workers(4);
+			Assert::AreEqual(workers.getThreadCount(), 4u);
+
+			std::vector<int> visits(10007, 0);
+			std::vector<int> participantItems(workers.getThreadCount(), 0);
+			for (int loop = 0; loop < 20; loop++)
+			{
+				workers.parallelFor(visits.size(), 64, [&visits, &participantItems](std::size_t begin, std::size_t end, unsigned int participant)
+				{
+					Assert::IsTrue(end - begin <= 64);
+					for (std::size_t i = begin; i < end; i++) visits[i]++;
+					participantItems[participant] += (int)(end - begin);
+				});
+			}
+
+			for (std::size_t i = 0; i < visits.size(); i++) Assert::AreEqual(visits[i], 20);
+			int total = 0;
+			for (std::size_t i = 0; i < participantItems.size(); i++) total += participantItems[i];
+			Assert::AreEqual(total, 20 * 10007);
+		}
+
+		TEST_METHOD(SingleThreadOrShortLoopRunsOnCallingThread)
+		{
+			std::thread::id caller = std::this_thread::get_id();
+			WorkerPool serial(0);
+			Assert::AreEqual(serial.getThreadCount(), 1u);
+
+			WorkerPool parallel(3);
+			bool didRunElsewhere = false;
+			parallel.parallelFor(10, 64, [caller, &didRunElsewhere](std::size_t begin, std::size_t end, unsigned int participant)
+			{
+				if (std::this_thread::get_id() != caller || begin != 0 || end != 10 || participant != 0) didRunElsewhere = true;
+			});
+			serial.parallelFor(1000, 10, [caller, &didRunElsewhere](std::size_t begin, std::size_t end, unsigned int participant)
+			{
+				if (std::this_thread::get_id() != caller || end - begin != 1000 || participant != 0) didRunElsewhere = true;
+			});
+			Assert::IsFalse(didRunElsewhere);
+		}
+	};
+
+	TEST_CLASS(TripleBufferTests)
+	{
+	public:
+
+		TEST_METHOD(AcquireMovesOntoLatestPublishedValue)
+		{
+			TripleBuffer<int> buffer;
+			Assert::IsFalse(buffer.acquire());
+
+			buffer.getWriteBuffer() = 1;
+			buffer.publish();
+			buffer.getWriteBuffer() = 2;
+			buffer.publish();
+			Assert::IsTrue(buffer.acquire());
+			Assert::AreEqual(buffer.getReadBuffer(), 2);
+			Assert::IsFalse(buffer.acquire());
+			Assert::AreEqual(buffer.getReadBuffer(), 2);
+
+			buffer.getWriteBuffer() = 3;
+			Assert::AreEqual(buffer.getReadBuffer(), 2);
+			buffer.publish();
+			Assert::IsTrue(buffer.acquire());
+			Assert::AreEqual(buffer.getReadBuffer(), 3);
+		}
+
+		TEST_METHOD(ReaderNeverSeesPartialOrOlderValues)
+		{
+			TripleBuffer<std::vector<int>> buffer;
+			const int publishes = 20000;
+			std::thread writer([&buffer]()
+			{
+				for (int value = 1; value <= publishes; value++)
+				{
+					std::vector<int>& values = buffer.getWriteBuffer();
+					values.assign(16, value);
+					buffer.publish();
+				}
+			});
+
+			int lastSeen = 0;
+			bool isConsistent = true;
+			while (lastSeen < publishes)
+			{
+				if (!buffer.acquire()) continue;
+
+				const std::vector<int>& values = buffer.getReadBuffer();
+				for (std::size_t i = 0; i < values.size(); i++)
+				{
+					if (values[i] != values[0]) isConsistent = false;
+				}
+				if (values.size() != 16 || values[0] <= lastSeen) isConsistent = false;
+				lastSeen = values[0];
+			}
+			writer.join();
+
+			Assert::IsTrue(isConsistent);
+			Assert::AreEqual(lastSeen, publishes);
+		}
+	};
+
+	TEST_CLASS(HudCounterTests)
+	{
+	public:
+
+		TEST_METHOD(UnchangedValueDoesNotRebuild)
+		{
+			HudCounter counter("HudCounterTestsMissingFont.ttf", "Score: ", 120, 50, 1.0f, sf::Color::Green);
+			unsigned long rebuilds = counter.getRebuildCount();
+
+			counter.setValue(120);
+			Assert::AreEqual(counter.getRebuildCount(), rebuilds);
+
+			counter.setValue(7);
+			Assert::AreEqual(counter.getRebuildCount(), rebuilds + 1);
+			Assert::AreEqual(counter.getValue(), 7u);
+		}
+
+		TEST_METHOD(ValueHasOutlineAndFillQuadPerDigit)
+		{
+			HudCounter counter("HudCounterTestsMissingFont.ttf", "Coins: ", 0, 50, 1.0f, sf::Color::Green);
+			Assert::AreEqual(counter.getValueVertices().getVertexCount(), (std::size_t)8);
+
+			counter.setValue(4294967295u);
+			Assert::AreEqual(counter.getValueVertices().getVertexCount(), (std::size_t)80);
+
+			counter.setValue(305);
+			Assert::AreEqual(counter.getValueVertices().getVertexCount(), (std::size_t)24);
+		}
+	};
+
+	TEST_CLASS(FontAtlasTests)
+	{
+	public:
+
+		TEST_METHOD(UnloadedAtlasHasNoGlyphs)
+		{
+			FontAtlas atlas;
+
+			sf::Glyph glyph;
+			Assert::IsFalse(atlas.getGlyph('A', 50, 0.0f, glyph));
+			Assert::AreEqual(atlas.getKerning('A', 'V', 50), 0.0f);
+			Assert::AreEqual(atlas.getLineSpacing(50), 50.0f);
+		}
+
+		TEST_METHOD(StandardFacesCoverEveryTextSize)
+		{
+			std::vector<FontFace> faces = FontAtlas::getStandardFaces();
+			const unsigned int characterSizes[] = { 18, 20, 25, 30, 50, 75, 100 };
+			for (unsigned int characterSize : characterSizes)
+			{
+				bool found = false;
+				for (const FontFace& face : faces)
+				{
+					found = found || (face.characterSize == characterSize && face.outlineThickness == 0.0f);
+				}
+				Assert::IsTrue(found);
+			}
+
+			bool foundOutline = false;
+			for (const FontFace& face : faces)
+			{
+				foundOutline = foundOutline || (face.characterSize == 50 && face.outlineThickness == 1.0f);
+			}
+			Assert::IsTrue(foundOutline);
+		}
+
+		TEST_METHOD(GlyphQuadIsPaddedAndShiftedByOutline)
+		{
+			sf::Glyph glyph;
+			glyph.bounds = sf::FloatRect(2.0f, -10.0f, 6.0f, 10.0f);
+			glyph.textureRect = sf::IntRect(20, 30, 6, 10);
+			sf::VertexArray vertices(sf::Quads);
+			FontAtlas::addGlyphQuad(vertices, sf::Vector2f(100.0f, 50.0f), glyph, sf::Color::Black, 1.0f);
+
+			Assert::AreEqual(vertices.getVertexCount(), (std::size_t)4);
+			Assert::AreEqual(vertices[0].position.x, 100.0f);
+			Assert::AreEqual(vertices[0].position.y, 38.0f);
+			Assert::AreEqual(vertices[2].position.x, 108.0f);
+			Assert::AreEqual(vertices[2].position.y, 50.0f);
+			Assert::AreEqual(vertices[0].texCoords.x, 19.0f);
+			Assert::AreEqual(vertices[2].texCoords.y, 41.0f);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#ifndef PORTABLE_CPP_UNIT_TEST_H
+#define PORTABLE_CPP_UNIT_TEST_H
+
+#include <cmath>
+#include <cstdio>
+#include <cwchar>
+#include <exception>
+#include <string>
+
+/// <summary>
+/// A stand-in for the parts of the Visual Studio CppUnitTest framework used by UnitTests.cpp, so the tests build with any compiler.
+/// Used by the CMake build together with a runner generated by cmake/GenerateTestRunner.cmake. UnitTests.vcxproj uses the real framework.
+/// </summary>
+namespace Microsoft
+{
+	namespace VisualStudio
+	{
+		namespace CppUnitTestFramework
+		{
+			/// <summary>
+			/// Thrown by a failed assertion.
+			/// </summary>
+			class AssertFailure : public std::exception
+			{
+			public:
+				/// <summary>
+				/// Initializes the failure with the assertion that failed and the message passed to it.
+				/// </summary>
+				/// <param name="assertion">The name of the assertion that failed.</param>
+				/// <param name="message">The message passed to the assertion, or null.</param>
+				AssertFailure(const char* assertion, const wchar_t* message)
+				{
+					description = assertion;
+					if (message == nullptr) return;
+
+					description += ": ";
+					for (const wchar_t* character = message; *character != L'\0'; character++)
+					{
+						description += *character < 128 ? (char)*character : '?';
+					}
+				}
+
+				/// <summary>
+				/// Gets the assertion that failed and its message.
+				/// </summary>
+				/// <returns>The assertion that failed and its message.</returns>
+				const char* what() const noexcept
+				{
+					return description.c_str();
+				}
+
+			private:
+				/// <summary>
+				/// The assertion that failed and its message.
+				/// </summary>
+				std::string description;
+			};
+
+			/// <summary>
+			/// The assertions available to the tests.
+			/// </summary>
+			class Assert
+			{
+			public:
+				/// <summary>
+				/// Fails unless the two values are equal.
+				/// </summary>
+				template <typename T>
+				static void AreEqual(const T& expected, const T& actual, const wchar_t* message = nullptr)
+				{
+					if (!(expected == actual)) throw AssertFailure("AreEqual", message);
+				}
+
+				/// <summary>
+				/// Fails unless the two floats are within the provided tolerance of each other.
+				/// </summary>
+				static void AreEqual(float expected, float actual, float tolerance, const wchar_t* message = nullptr)
+				{
+					if (std::fabs(expected - actual) > tolerance) throw AssertFailure("AreEqual", message);
+				}
+
+				/// <summary>
+				/// Fails unless the two doubles are within the provided tolerance of each other.
+				/// </summary>
+				static void AreEqual(double expected, double actual, double tolerance, const wchar_t* message = nullptr)
+				{
+					if (std::fabs(expected - actual) > tolerance) throw AssertFailure("AreEqual", message);
+				}
+
+				/// <summary>
+				/// Fails if the two values are equal.
+				/// </summary>
+				template <typename T>
+				static void AreNotEqual(const T& notExpected, const T& actual, const wchar_t* message = nullptr)
+				{
+					if (notExpected == actual) throw AssertFailure("AreNotEqual", message);
+				}
+
+				/// <summary>
+				/// Fails unless the condition is true.
+				/// </summary>
+				static void IsTrue(bool condition, const wchar_t* message = nullptr)
+				{
+					if (!condition) throw AssertFailure("IsTrue", message);
+				}
+
+				/// <summary>
+				/// Fails unless the condition is false.
+				/// </summary>
+				static void IsFalse(bool condition, const wchar_t* message = nullptr)
+				{
+					if (condition) throw AssertFailure("IsFalse", message);
+				}
+
+				/// <summary>
+				/// Always fails.
+				/// </summary>
+				static void Fail(const wchar_t* message = nullptr)
+				{
+					throw AssertFailure("Fail", message);
+				}
+			};
+		}
+	}
+}
+
+#define TEST_CLASS(className) class className
+#define TEST_METHOD(methodName) void methodName()
+
+namespace PortableCppUnitTest
+{
+	/// <summary>
+	/// Runs one test method on a new instance of its test class and reports a failure.
+	/// </summary>
+	/// <param name="method">The test method.</param>
+	/// <param name="name">The name of the test, printed if it fails.</param>
+	/// <returns>True if the test passed.</returns>
+	template <typename TestClass>
+	bool run(void (TestClass::* method)(), const char* name)
+	{
+		try
+		{
+			TestClass instance;
+			(instance.*method)();
+			return true;
+		}
+		catch (const std::exception& ex)
+		{
+			std::printf("FAILED %s: %s\n", name, ex.what());
+		}
+		catch (...)
+		{
+			std::printf("FAILED %s\n", name);
+		}
+
+		return false;
+	}
+}
+
+#endif // !PORTABLE_CPP_UNIT_TEST_H
@@ -0,0 +1,21 @@
+# Runs the same headless session on one thread and on several, and fails if the reports differ in anything but their timings.
+# Run with: cmake -DHEADLESS=<PA8Headless> -DSCRIPT=<session script> -DTICKS=<ticks> -DTHREADS=<thread count> -P CompareHeadlessThreads.cmake
+
+foreach(threads 1 ${THREADS})
+    execute_process(
+        COMMAND ${HEADLESS} --ticks ${TICKS} --threads ${threads} --script ${SCRIPT}
+        OUTPUT_VARIABLE report
+        RESULT_VARIABLE result
+        )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "PA8Headless failed on ${threads} threads.")
+    endif()
+
+    # The timing lines (total_ms, mean_us_per_tick, ...) depend on the machine, not the simulation.
+    string(REGEX REPLACE "[^\n]*_(ms|us)[^\n]*\n?" "" report "${report}")
+    set(report_${threads} "${report}")
+endforeach()
+
+if(NOT report_1 STREQUAL report_${THREADS})
+    message(FATAL_ERROR "The session diverged between 1 and ${THREADS} threads.\n1 thread:\n${report_1}\n${THREADS} threads:\n${report_${THREADS}}")
+endif()
@@ -0,0 +1,34 @@
+# Generates a main function that runs every TEST_METHOD of every TEST_CLASS in a Visual Studio CppUnitTest source, so the tests can
+# run outside Visual Studio against UnitTests/portable/CppUnitTest.h.
+# Run with: cmake -DTEST_SOURCE=<UnitTests.cpp> -DRUNNER=<output.cpp> -P GenerateTestRunner.cmake
+
+file(READ "${TEST_SOURCE}" source)
+string(REGEX MATCHALL "TEST_(CLASS|METHOD)\\([A-Za-z0-9_]+\\)" declarations "${source}")
+
+set(calls "")
+set(test_class "")
+foreach(declaration IN LISTS declarations)
+    string(REGEX REPLACE "TEST_(CLASS|METHOD)\\(([A-Za-z0-9_]+)\\)" "\\1;\\2" parts "${declaration}")
+    list(GET parts 0 kind)
+    list(GET parts 1 name)
+    if(kind STREQUAL "CLASS")
+        set(test_class "${name}")
+    else()
+        string(APPEND calls "\tfailed += !PortableCppUnitTest::run<UnitTests::${test_class}>(&UnitTests::${test_class}::${name}, \"${test_class}::${name}\");\n\ttotal++;\n")
+    endif()
+endforeach()
+
+file(WRITE "${RUNNER}.tmp" "// Generated from ${TEST_SOURCE} by GenerateTestRunner.cmake. Do not edit.
+#include \"UnitTests.cpp\"
+
+int main()
+{
+\tint failed = 0;
+\tint total = 0;
+${calls}
+\tstd::printf(\"%d of %d tests passed\\n\", total - failed, total);
+\treturn failed == 0 ? 0 : 1;
+}
+")
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${RUNNER}.tmp" "${RUNNER}")
+file(REMOVE "${RUNNER}.tmp")
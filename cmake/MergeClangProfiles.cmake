@@ -0,0 +1,15 @@
+# Merges the raw profiles written by a Clang-instrumented training run into pa8.profdata.
+# Run with: cmake -DLLVM_PROFDATA=<llvm-profdata> -DPGO_DIR=<profile directory> -P MergeClangProfiles.cmake
+
+file(GLOB raw_profiles "${PGO_DIR}/*.profraw")
+if(NOT raw_profiles)
+    message(FATAL_ERROR "No raw profiles in ${PGO_DIR}.")
+endif()
+
+execute_process(
+    COMMAND ${LLVM_PROFDATA} merge -output=${PGO_DIR}/pa8.profdata ${raw_profiles}
+    RESULT_VARIABLE result
+    )
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "llvm-profdata failed to merge the profiles in ${PGO_DIR}.")
+endif()
@@ -0,0 +1,60 @@
+# Profile-guided optimisation for GCC and Clang, selected with PA8_PGO:
+#   GENERATE  instruments every target. Build, then build pgo-train to run the scripted headless session and record a profile.
+#   USE       optimises every target with the recorded profile.
+# Both stages must use the same build directory, since GCC matches profiles to object files by path.
+
+if(PA8_PGO STREQUAL "GENERATE")
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        add_compile_options(-fprofile-generate=${PA8_PGO_DIR} -fprofile-update=prefer-atomic)
+        add_link_options(-fprofile-generate=${PA8_PGO_DIR})
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        add_compile_options(-fprofile-instr-generate)
+        add_link_options(-fprofile-instr-generate)
+    else()
+        message(FATAL_ERROR "PA8_PGO is only supported with GCC and Clang. Use the Visual Studio PGO tooling with MSVC.")
+    endif()
+elseif(PA8_PGO STREQUAL "USE")
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        add_compile_options(-fprofile-use=${PA8_PGO_DIR} -fprofile-correction -Wno-missing-profile)
+        add_link_options(-fprofile-use=${PA8_PGO_DIR})
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        if(NOT EXISTS "${PA8_PGO_DIR}/pa8.profdata")
+            message(FATAL_ERROR "No profile at ${PA8_PGO_DIR}/pa8.profdata. Build pgo-train with PA8_PGO=GENERATE first.")
+        endif()
+        add_compile_options(-fprofile-instr-use=${PA8_PGO_DIR}/pa8.profdata -Wno-profile-instr-unprofiled)
+        add_link_options(-fprofile-instr-use=${PA8_PGO_DIR}/pa8.profdata)
+    else()
+        message(FATAL_ERROR "PA8_PGO is only supported with GCC and Clang. Use the Visual Studio PGO tooling with MSVC.")
+    endif()
+elseif(NOT PA8_PGO STREQUAL "OFF")
+    message(FATAL_ERROR "PA8_PGO must be OFF, GENERATE or USE, not ${PA8_PGO}.")
+endif()
+
+# Adds the pgo-train target when instrumenting. It runs the scripted session through the headless runner, which exercises the
+# simulation library the game links as well, and merges Clang's raw profiles into pa8.profdata.
+function(pa8_add_pgo_training)
+    if(NOT PA8_PGO STREQUAL "GENERATE")
+        return()
+    endif()
+
+    set(merge_command "")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        find_program(LLVM_PROFDATA NAMES llvm-profdata)
+        if(NOT LLVM_PROFDATA)
+            message(FATAL_ERROR "llvm-profdata is needed to merge Clang profiles.")
+        endif()
+        set(merge_command COMMAND ${CMAKE_COMMAND} -DLLVM_PROFDATA=${LLVM_PROFDATA} -DPGO_DIR=${PA8_PGO_DIR}
+            -P "${PROJECT_SOURCE_DIR}/cmake/MergeClangProfiles.cmake")
+    endif()
+
+    add_custom_target(pgo-train
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${PA8_PGO_DIR}
+        COMMAND ${CMAKE_COMMAND} -E env "LLVM_PROFILE_FILE=${PA8_PGO_DIR}/pa8-%p.profraw"
+            $<TARGET_FILE:PA8Headless> --ticks 7200 --script "${PROJECT_SOURCE_DIR}/cmake/pgo_session.txt"
+        ${merge_command}
+        DEPENDS PA8Headless
+        WORKING_DIRECTORY ${PROJECT_SOURCE_DIR}
+        COMMENT "Recording the PGO profile from the scripted headless session"
+        VERBATIM
+        )
+endfunction()